@@ -36,6 +36,7 @@
 
 namespace dawn::platform {
 class Platform;
+enum class TaskPriority;
 }  // namespace dawn::platform
 
 namespace dawn::native {
@@ -223,6 +224,12 @@ DAWN_NATIVE_EXPORT std::vector<const char*> GetProcMapNamesForTesting();
 
 DAWN_NATIVE_EXPORT bool DeviceTick(WGPUDevice device);
 
+// Sets the priority of the worker tasks posted by the CreateComputePipelineAsync() and
+// CreateRenderPipelineAsync() calls that follow. Lowering it while warming up pipelines lets the
+// pipelines that the application is waiting on start first. Defaults to TaskPriority::Normal.
+DAWN_NATIVE_EXPORT void SetAsyncPipelineCreationPriority(WGPUDevice device,
+                                                         dawn::platform::TaskPriority priority);
+
 DAWN_NATIVE_EXPORT bool InstanceProcessEvents(WGPUInstance instance);
 
 // ErrorInjector functions used for testing only. Defined in dawn_native/ErrorInjector.cpp
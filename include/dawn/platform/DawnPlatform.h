@@ -78,12 +78,24 @@ class DAWN_PLATFORM_EXPORT WaitableEvent {
 
 using PostWorkerTaskCallback = void (*)(void* userdata);
 
+// Tasks with a higher priority are started before any queued task of a lower priority.
+enum class TaskPriority {
+    Low,     // Work that nothing is waiting on yet, like pipeline warm-up
+    Normal,  // Default priority
+    High,    // Work that is blocking the application
+};
+
 class DAWN_PLATFORM_EXPORT WorkerTaskPool {
   public:
     WorkerTaskPool() = default;
     virtual ~WorkerTaskPool() = default;
     virtual std::unique_ptr<WaitableEvent> PostWorkerTask(PostWorkerTaskCallback,
                                                           void* userdata) = 0;
+    // The default implementation ignores |priority| and calls PostWorkerTask().
+    virtual std::unique_ptr<WaitableEvent> PostWorkerTaskWithPriority(
+        PostWorkerTaskCallback callback,
+        void* userdata,
+        TaskPriority priority);
 };
 
 // These features map to similarly named ones in src/chromium/src/gpu/config/gpu_finch_features.h
@@ -143,6 +155,10 @@ class DAWN_PLATFORM_EXPORT Platform {
 
     virtual std::unique_ptr<WorkerTaskPool> CreateWorkerTaskPool();
 
+    // The maximum number of threads used by the pool returned by the default implementation of
+    // CreateWorkerTaskPool(). Zero means one thread per hardware thread.
+    virtual uint32_t GetMaxWorkerThreadCount();
+
     // Hook for querying if a Finch feature is enabled.
     virtual bool IsFeatureEnabled(Features feature);
 
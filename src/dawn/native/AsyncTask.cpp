@@ -37,6 +37,10 @@ AsyncTaskManager::AsyncTaskManager(dawn::platform::WorkerTaskPool* workerTaskPoo
     : mWorkerTaskPool(workerTaskPool) {}
 
 void AsyncTaskManager::PostTask(AsyncTask asyncTask) {
+    PostTask(std::move(asyncTask), dawn::platform::TaskPriority::Normal);
+}
+
+void AsyncTaskManager::PostTask(AsyncTask asyncTask, dawn::platform::TaskPriority priority) {
     // If these allocations becomes expensive, we can slab-allocate tasks.
     Ref<WaitableTask> waitableTask = AcquireRef(new WaitableTask());
     waitableTask->taskManager = this;
@@ -55,7 +59,7 @@ void AsyncTaskManager::PostTask(AsyncTask asyncTask) {
     // The worker function will acquire and release the task upon completion.
     waitableTask->Reference();
     waitableTask->waitableEvent =
-        mWorkerTaskPool->PostWorkerTask(DoWaitableTask, waitableTask.Get());
+        mWorkerTaskPool->PostWorkerTaskWithPriority(DoWaitableTask, waitableTask.Get(), priority);
 }
 
 void AsyncTaskManager::HandleTaskCompletion(WaitableTask* task) {
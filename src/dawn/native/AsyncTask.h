@@ -40,6 +40,7 @@
 namespace dawn::platform {
 class WaitableEvent;
 class WorkerTaskPool;
+enum class TaskPriority;
 }  // namespace dawn::platform
 
 namespace dawn::native {
@@ -55,7 +56,9 @@ class AsyncTaskManager {
   public:
     explicit AsyncTaskManager(dawn::platform::WorkerTaskPool* workerTaskPool);
 
+    // Posts the task with TaskPriority::Normal.
     void PostTask(AsyncTask asyncTask);
+    void PostTask(AsyncTask asyncTask, dawn::platform::TaskPriority priority);
     void WaitAllPendingTasks();
     bool HasPendingTasks();
 
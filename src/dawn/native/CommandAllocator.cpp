@@ -37,6 +37,116 @@
 
 namespace dawn::native {
 
+namespace {
+
+size_t GetSizeClassIndex(size_t size) {
+    DAWN_ASSERT(size <= CommandBlockPool::kMaxBlockSize);
+    return Log2Ceil(uint64_t(std::max(size, CommandBlockPool::kMinBlockSize))) -
+           ConstexprLog2(CommandBlockPool::kMinBlockSize);
+}
+
+void FreeBlock(BlockDef* block) {
+    uint8_t* data = block->block.ExtractAsDangling();
+    if (block->pool != nullptr) {
+        block->pool->Release(data, block->size);
+    } else {
+        free(data);
+    }
+}
+
+}  // anonymous namespace
+
+CommandBlockPool::CommandBlockPool() = default;
+
+CommandBlockPool::~CommandBlockPool() {
+    for (SizeClass& sizeClass : mSizeClasses) {
+        DAWN_ASSERT(sizeClass.inUseCount == 0);
+        for (uint8_t* block : sizeClass.freeBlocks) {
+            free(block);
+        }
+    }
+}
+
+uint8_t* CommandBlockPool::Acquire(size_t* size) {
+    if (*size > kMaxBlockSize) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mMissCount++;
+        }
+        return static_cast<uint8_t*>(malloc(*size));
+    }
+
+    size_t index = GetSizeClassIndex(*size);
+    *size = kMinBlockSize << index;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        SizeClass& sizeClass = mSizeClasses[index];
+        sizeClass.inUseCount++;
+        sizeClass.highWaterMark = std::max(sizeClass.highWaterMark, sizeClass.inUseCount);
+        if (!sizeClass.freeBlocks.empty()) {
+            uint8_t* block = sizeClass.freeBlocks.back();
+            sizeClass.freeBlocks.pop_back();
+            mHitCount++;
+            return block;
+        }
+        mMissCount++;
+    }
+
+    uint8_t* block = static_cast<uint8_t*>(malloc(*size));
+    if (DAWN_UNLIKELY(block == nullptr)) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mSizeClasses[index].inUseCount--;
+    }
+    return block;
+}
+
+void CommandBlockPool::Release(uint8_t* block, size_t size) {
+    if (size > kMaxBlockSize) {
+        free(block);
+        return;
+    }
+
+    size_t index = GetSizeClassIndex(size);
+    DAWN_ASSERT(size == kMinBlockSize << index);
+    std::lock_guard<std::mutex> lock(mMutex);
+    SizeClass& sizeClass = mSizeClasses[index];
+    DAWN_ASSERT(sizeClass.inUseCount > 0);
+    sizeClass.inUseCount--;
+    sizeClass.freeBlocks.push_back(block);
+}
+
+void CommandBlockPool::Trim() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (SizeClass& sizeClass : mSizeClasses) {
+        DAWN_ASSERT(sizeClass.highWaterMark >= sizeClass.inUseCount);
+        size_t maxCachedCount = sizeClass.highWaterMark - sizeClass.inUseCount;
+        while (sizeClass.freeBlocks.size() > maxCachedCount) {
+            free(sizeClass.freeBlocks.back());
+            sizeClass.freeBlocks.pop_back();
+        }
+        sizeClass.highWaterMark = sizeClass.inUseCount;
+    }
+}
+
+uint64_t CommandBlockPool::GetHitCount() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mHitCount;
+}
+
+uint64_t CommandBlockPool::GetMissCount() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mMissCount;
+}
+
+size_t CommandBlockPool::GetCachedBlockCount() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    size_t count = 0;
+    for (const SizeClass& sizeClass : mSizeClasses) {
+        count += sizeClass.freeBlocks.size();
+    }
+    return count;
+}
+
 // TODO(cwallez@chromium.org): figure out a way to have more type safety for the iterator
 
 CommandIterator::CommandIterator() {
@@ -92,11 +202,14 @@ bool CommandIterator::NextCommandIdInNewBlock(uint32_t* commandId) {
         return false;
     }
     mCurrentPtr = AlignPtr(mBlocks[mCurrentBlock].block.get(), alignof(uint32_t));
+    mPackedState = {};
     return NextCommandId(commandId);
 }
 
 void CommandIterator::Reset() {
     mCurrentBlock = 0;
+    mNextCommandIsPacked = false;
+    mPackedState = {};
 
     if (mBlocks.empty()) {
         // This will case the first NextCommandId call to try to move to the next block and stop
@@ -117,7 +230,7 @@ void CommandIterator::MakeEmptyAsDataWasDestroyed() {
 
     mCurrentPtr = reinterpret_cast<uint8_t*>(&mEndOfBlock);
     for (BlockDef& block : mBlocks) {
-        free(block.block.ExtractAsDangling());
+        FreeBlock(&block);
     }
     mBlocks.clear();
     Reset();
@@ -142,16 +255,23 @@ CommandAllocator::CommandAllocator() {
     ResetPointers();
 }
 
+CommandAllocator::CommandAllocator(CommandBlockPool* blockPool) : mBlockPool(blockPool) {
+    ResetPointers();
+}
+
 CommandAllocator::~CommandAllocator() {
     Reset();
 }
 
 CommandAllocator::CommandAllocator(CommandAllocator&& other)
-    : mBlocks(std::move(other.mBlocks)), mLastAllocationSize(other.mLastAllocationSize) {
+    : mBlocks(std::move(other.mBlocks)),
+      mLastAllocationSize(other.mLastAllocationSize),
+      mBlockPool(other.mBlockPool) {
     other.mBlocks.clear();
     if (!other.IsEmpty()) {
         mCurrentPtr = other.mCurrentPtr;
         mEndPtr = other.mEndPtr;
+        mPackedState = other.mPackedState;
     } else {
         ResetPointers();
     }
@@ -160,11 +280,13 @@ CommandAllocator::CommandAllocator(CommandAllocator&& other)
 
 CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
     Reset();
+    mBlockPool = other.mBlockPool;
     if (!other.IsEmpty()) {
         std::swap(mBlocks, other.mBlocks);
         mLastAllocationSize = other.mLastAllocationSize;
         mCurrentPtr = other.mCurrentPtr;
         mEndPtr = other.mEndPtr;
+        mPackedState = other.mPackedState;
     }
     other.Reset();
     return *this;
@@ -173,10 +295,19 @@ CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
 void CommandAllocator::Reset() {
     ResetPointers();
     for (BlockDef& block : mBlocks) {
-        free(block.block.ExtractAsDangling());
+        FreeBlock(&block);
     }
     mBlocks.clear();
     mLastAllocationSize = kDefaultBaseAllocationSize;
+    mPackedState = {};
+}
+
+size_t CommandAllocator::GetAllocatedSizeForTesting() const {
+    size_t size = 0;
+    for (const BlockDef& block : mBlocks) {
+        size += block.size;
+    }
+    return size;
 }
 
 bool CommandAllocator::IsEmpty() const {
@@ -221,14 +352,21 @@ bool CommandAllocator::GetNewBlock(size_t minimumSize) {
     // Allocate blocks doubling sizes each time, to a maximum of 16k (or at least minimumSize).
     mLastAllocationSize = std::max(minimumSize, std::min(mLastAllocationSize * 2, size_t(16384)));
 
-    uint8_t* block = static_cast<uint8_t*>(malloc(mLastAllocationSize));
+    uint8_t* block;
+    if (mBlockPool != nullptr) {
+        // The pool rounds the size up to its size class.
+        block = mBlockPool->Acquire(&mLastAllocationSize);
+    } else {
+        block = static_cast<uint8_t*>(malloc(mLastAllocationSize));
+    }
     if (DAWN_UNLIKELY(block == nullptr)) {
         return false;
     }
 
-    mBlocks.push_back({mLastAllocationSize, block});
+    mBlocks.push_back({mLastAllocationSize, block, mBlockPool});
     mCurrentPtr = AlignPtr(block, alignof(uint32_t));
     mEndPtr = block + mLastAllocationSize;
+    mPackedState = {};
     return true;
 }
 
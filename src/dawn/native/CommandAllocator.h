@@ -28,9 +28,13 @@
 #ifndef SRC_DAWN_NATIVE_COMMANDALLOCATOR_H_
 #define SRC_DAWN_NATIVE_COMMANDALLOCATOR_H_
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <mutex>
+#include <new>
+#include <type_traits>
 #include <vector>
 
 #include "dawn/common/Assert.h"
@@ -67,19 +71,126 @@ namespace dawn::native {
 // and must tell the CommandIterator when the allocated commands have been processed for
 // deletion.
 
+class CommandBlockPool;
+
 // These are the lists of blocks, should not be used directly, only through CommandAllocator
 // and CommandIterator
 struct BlockDef {
     size_t size;
     raw_ptr<uint8_t> block;
+    // The pool the block is returned to when it is freed, if any.
+    raw_ptr<CommandBlockPool> pool = nullptr;
 };
 using CommandBlocks = std::vector<BlockDef>;
 
+// A cache of the blocks of CommandAllocators, shared by all the encoders of a device so that
+// recording many small command buffers doesn't malloc and free blocks for each one. Blocks are
+// cached in power-of-two size classes; blocks larger than the biggest class aren't cached.
+//
+// The cache is trimmed by Trim(), which frees the cached blocks that weren't needed since the
+// previous Trim(): each size class keeps at most as many blocks as the most that were in use at
+// once since then (the high-water mark).
+class CommandBlockPool : public NonCopyable {
+  public:
+    static constexpr size_t kMinBlockSize = 4096;
+    static constexpr size_t kMaxBlockSize = 16384;
+
+    CommandBlockPool();
+    ~CommandBlockPool();
+
+    // Returns a block of at least |*size| bytes and updates |*size| to the actual size of the
+    // block. Returns nullptr if the allocation failed.
+    uint8_t* Acquire(size_t* size);
+    // |size| must be the size returned by Acquire().
+    void Release(uint8_t* block, size_t size);
+
+    void Trim();
+
+    // Acquisitions served from the cache, and acquisitions that had to allocate.
+    uint64_t GetHitCount() const;
+    uint64_t GetMissCount() const;
+    size_t GetCachedBlockCount() const;
+
+  private:
+    static constexpr size_t kSizeClassCount = 3;
+    static_assert(kMaxBlockSize == kMinBlockSize << (kSizeClassCount - 1));
+
+    struct SizeClass {
+        std::vector<uint8_t*> freeBlocks;
+        size_t inUseCount = 0;
+        size_t highWaterMark = 0;
+    };
+
+    mutable std::mutex mMutex;
+    std::array<SizeClass, kSizeClassCount> mSizeClasses;
+    uint64_t mHitCount = 0;
+    uint64_t mMissCount = 0;
+};
+
 namespace detail {
 constexpr uint32_t kEndOfBlock = std::numeric_limits<uint32_t>::max();
 constexpr uint32_t kAdditionalData = std::numeric_limits<uint32_t>::max() - 1;
+
+// The ID of a packed command is the ID of the command plus kPackedCommandFlag. Command IDs are
+// small enums so they never reach it on their own.
+constexpr uint32_t kPackedCommandFlag = uint32_t(1) << 31;
+// The previous value of each field of the packed commands, see PackedCommandTraits.
+constexpr size_t kPackedStateSize = 16;
+using PackedCommandState = std::array<uint32_t, kPackedStateSize>;
+// The largest packed command that CommandIterator can decode.
+constexpr size_t kMaxPackedCommandSize = 32;
+constexpr size_t kMaxVarintSize = 5;
+
+// Signed deltas are zigzag-encoded so that small negative values stay small.
+DAWN_FORCE_INLINE uint32_t ZigZagEncode(uint32_t delta) {
+    return (delta << 1) ^ (0u - (delta >> 31));
+}
+DAWN_FORCE_INLINE uint32_t ZigZagDecode(uint32_t value) {
+    return (value >> 1) ^ (0u - (value & 1));
+}
+
+DAWN_FORCE_INLINE uint8_t* WriteVarint(uint8_t* out, uint32_t value) {
+    while (value >= 0x80) {
+        *out++ = static_cast<uint8_t>(value) | 0x80;
+        value >>= 7;
+    }
+    *out++ = static_cast<uint8_t>(value);
+    return out;
+}
+DAWN_FORCE_INLINE uint8_t* ReadVarint(uint8_t* in, uint32_t* value) {
+    uint32_t result = 0;
+    for (uint32_t shift = 0;; shift += 7) {
+        uint8_t byte = *in++;
+        result |= uint32_t(byte & 0x7F) << shift;
+        if (byte < 0x80) {
+            break;
+        }
+    }
+    *value = result;
+    return in;
+}
 }  // namespace detail
 
+// Commands made only of small 32-bit values can be recorded in a packed format with
+// CommandAllocator::AllocatePacked() by specializing PackedCommandTraits. Each field is stored as
+// the varint of its zigzagged difference with the same field of the previous command of that type
+// in the block, so repeated or slowly changing values take a single byte. CommandIterator decodes
+// packed commands transparently, but the pointer it returns for them is only valid until the next
+// call to NextCommand.
+//
+// Specializations provide:
+//   static constexpr bool kIsPacked = true;
+//   // The number of uint32_t fields, and the first of the kFieldCount entries of the packed
+//   // state that hold their previous values. Ranges of different types must not overlap.
+//   static constexpr size_t kFieldCount;
+//   static constexpr size_t kStateOffset;
+//   static void ToFields(const T& cmd, uint32_t* fields);
+//   static void FromFields(const uint32_t* fields, T* cmd);
+template <typename T>
+struct PackedCommandTraits {
+    static constexpr bool kIsPacked = false;
+};
+
 class CommandAllocator;
 
 class CommandIterator : public NonCopyable {
@@ -101,6 +212,11 @@ class CommandIterator : public NonCopyable {
     }
     template <typename T>
     T* NextCommand() {
+        if constexpr (PackedCommandTraits<T>::kIsPacked) {
+            if (mNextCommandIsPacked) {
+                return NextPackedCommand<T>();
+            }
+        }
         return static_cast<T*>(NextCommand(sizeof(T), alignof(T)));
     }
     template <typename T>
@@ -128,12 +244,40 @@ class CommandIterator : public NonCopyable {
 
         if (id != detail::kEndOfBlock) {
             mCurrentPtr = idPtr + sizeof(uint32_t);
+            if (DAWN_UNLIKELY(id >= detail::kPackedCommandFlag && id != detail::kAdditionalData)) {
+                id -= detail::kPackedCommandFlag;
+                mNextCommandIsPacked = true;
+            }
             *commandId = id;
             return true;
         }
         return NextCommandIdInNewBlock(commandId);
     }
 
+    template <typename T>
+    T* NextPackedCommand() {
+        using Traits = PackedCommandTraits<T>;
+        static_assert(std::is_trivially_destructible_v<T>);
+        static_assert(sizeof(T) <= detail::kMaxPackedCommandSize);
+        static_assert(alignof(T) <= alignof(uint64_t));
+
+        mNextCommandIsPacked = false;
+        uint32_t fields[Traits::kFieldCount];
+        uint8_t* ptr = mCurrentPtr.get();
+        for (size_t i = 0; i < Traits::kFieldCount; ++i) {
+            uint32_t value;
+            ptr = detail::ReadVarint(ptr, &value);
+            uint32_t& previous = mPackedState[Traits::kStateOffset + i];
+            previous += detail::ZigZagDecode(value);
+            fields[i] = previous;
+        }
+        mCurrentPtr = ptr;
+
+        T* command = new (mPackedCommandStorage) T;
+        Traits::FromFields(fields, command);
+        return command;
+    }
+
     bool NextCommandIdInNewBlock(uint32_t* commandId);
 
     DAWN_FORCE_INLINE void* NextCommand(size_t commandSize, size_t commandAlignment) {
@@ -159,14 +303,22 @@ class CommandIterator : public NonCopyable {
     size_t mCurrentBlock = 0;
     // Used to avoid a special case for empty iterators.
     uint32_t mEndOfBlock = detail::kEndOfBlock;
+
+    // Decoding state of the packed commands, reset at the start of each block.
+    bool mNextCommandIsPacked = false;
+    detail::PackedCommandState mPackedState = {};
+    alignas(uint64_t) uint8_t mPackedCommandStorage[detail::kMaxPackedCommandSize];
 };
 
 class CommandAllocator : public NonCopyable {
   public:
     CommandAllocator();
+    // Blocks are taken from and returned to |blockPool|, which must outlive the blocks.
+    explicit CommandAllocator(CommandBlockPool* blockPool);
     ~CommandAllocator();
 
-    // NOTE: A moved-from CommandAllocator is reset to its initial empty state.
+    // NOTE: A moved-from CommandAllocator is reset to its initial empty state, and keeps its
+    // block pool.
     CommandAllocator(CommandAllocator&&);
     CommandAllocator& operator=(CommandAllocator&&);
 
@@ -189,6 +341,41 @@ class CommandAllocator : public NonCopyable {
         return result;
     }
 
+    // Records |command| in the packed format described at PackedCommandTraits. Returns false if
+    // the allocation failed.
+    template <typename T, typename E>
+    bool AllocatePacked(E commandId, const T& command) {
+        using Traits = PackedCommandTraits<T>;
+        static_assert(sizeof(E) == sizeof(uint32_t));
+        static_assert(Traits::kIsPacked);
+        static_assert(Traits::kStateOffset + Traits::kFieldCount <= detail::kPackedStateSize);
+        DAWN_ASSERT(static_cast<uint32_t>(commandId) < detail::kPackedCommandFlag);
+
+        // Reserve the worst case size. This may start a new block, which resets the packed
+        // state, so it has to happen before computing the deltas.
+        uint8_t* ptr =
+            Allocate(static_cast<uint32_t>(commandId) + detail::kPackedCommandFlag,
+                     Traits::kFieldCount * detail::kMaxVarintSize, alignof(uint8_t));
+        if (!ptr) {
+            return false;
+        }
+
+        uint32_t fields[Traits::kFieldCount];
+        Traits::ToFields(command, fields);
+        for (size_t i = 0; i < Traits::kFieldCount; ++i) {
+            uint32_t& previous = mPackedState[Traits::kStateOffset + i];
+            ptr = detail::WriteVarint(ptr, detail::ZigZagEncode(fields[i] - previous));
+            previous = fields[i];
+        }
+
+        // Give back the part of the reservation that wasn't used.
+        mCurrentPtr = AlignPtr(ptr, alignof(uint32_t));
+        return true;
+    }
+
+    // The total size of the blocks currently held by the allocator.
+    size_t GetAllocatedSizeForTesting() const;
+
     template <typename T>
     T* AllocateData(size_t count) {
         static_assert(alignof(T) <= kMaxSupportedAlignment);
@@ -269,6 +456,10 @@ class CommandAllocator : public NonCopyable {
 
     CommandBlocks mBlocks;
     size_t mLastAllocationSize = kDefaultBaseAllocationSize;
+    raw_ptr<CommandBlockPool> mBlockPool = nullptr;
+
+    // Encoding state of the packed commands, reset at the start of each block.
+    detail::PackedCommandState mPackedState = {};
 
     // Data used for the block range at initialization so that the first call to Allocate sees
     // there is not enough space and calls GetNewBlock. This avoids having to special case the
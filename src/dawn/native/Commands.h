@@ -38,6 +38,7 @@
 
 #include "dawn/native/AttachmentState.h"
 #include "dawn/native/BindingInfo.h"
+#include "dawn/native/CommandAllocator.h"
 #include "dawn/native/Texture.h"
 
 #include "dawn/native/dawn_platform.h"
@@ -223,6 +224,24 @@ struct DispatchCmd {
     uint32_t z;
 };
 
+// Packed when Toggle::UsePackedCommandEncoding is enabled.
+template <>
+struct PackedCommandTraits<DispatchCmd> {
+    static constexpr bool kIsPacked = true;
+    static constexpr size_t kFieldCount = 3;
+    static constexpr size_t kStateOffset = 9;
+    static void ToFields(const DispatchCmd& cmd, uint32_t* fields) {
+        fields[0] = cmd.x;
+        fields[1] = cmd.y;
+        fields[2] = cmd.z;
+    }
+    static void FromFields(const uint32_t* fields, DispatchCmd* cmd) {
+        cmd->x = fields[0];
+        cmd->y = fields[1];
+        cmd->z = fields[2];
+    }
+};
+
 struct DispatchIndirectCmd {
     DispatchIndirectCmd();
     ~DispatchIndirectCmd();
@@ -246,6 +265,49 @@ struct DrawIndexedCmd {
     uint32_t firstInstance;
 };
 
+// Draws are the most common commands in render passes and bundles, and their arguments are
+// usually small or close to those of the previous draw, so they are packed when
+// Toggle::UsePackedCommandEncoding is enabled.
+template <>
+struct PackedCommandTraits<DrawCmd> {
+    static constexpr bool kIsPacked = true;
+    static constexpr size_t kFieldCount = 4;
+    static constexpr size_t kStateOffset = 0;
+    static void ToFields(const DrawCmd& cmd, uint32_t* fields) {
+        fields[0] = cmd.vertexCount;
+        fields[1] = cmd.instanceCount;
+        fields[2] = cmd.firstVertex;
+        fields[3] = cmd.firstInstance;
+    }
+    static void FromFields(const uint32_t* fields, DrawCmd* cmd) {
+        cmd->vertexCount = fields[0];
+        cmd->instanceCount = fields[1];
+        cmd->firstVertex = fields[2];
+        cmd->firstInstance = fields[3];
+    }
+};
+
+template <>
+struct PackedCommandTraits<DrawIndexedCmd> {
+    static constexpr bool kIsPacked = true;
+    static constexpr size_t kFieldCount = 5;
+    static constexpr size_t kStateOffset = 4;
+    static void ToFields(const DrawIndexedCmd& cmd, uint32_t* fields) {
+        fields[0] = cmd.indexCount;
+        fields[1] = cmd.instanceCount;
+        fields[2] = cmd.firstIndex;
+        fields[3] = static_cast<uint32_t>(cmd.baseVertex);
+        fields[4] = cmd.firstInstance;
+    }
+    static void FromFields(const uint32_t* fields, DrawIndexedCmd* cmd) {
+        cmd->indexCount = fields[0];
+        cmd->instanceCount = fields[1];
+        cmd->firstIndex = fields[2];
+        cmd->baseVertex = static_cast<int32_t>(fields[3]);
+        cmd->firstInstance = fields[4];
+    }
+};
+
 struct DrawIndirectCmd {
     DrawIndirectCmd();
     ~DrawIndirectCmd();
@@ -240,10 +240,11 @@ void ComputePassEncoder::APIDispatchWorkgroups(uint32_t workgroupCountX,
             // bindgroups.
             AddDispatchSyncScope();
 
-            DispatchCmd* dispatch = allocator->Allocate<DispatchCmd>(Command::Dispatch);
-            dispatch->x = workgroupCountX;
-            dispatch->y = workgroupCountY;
-            dispatch->z = workgroupCountZ;
+            DispatchCmd dispatch;
+            dispatch.x = workgroupCountX;
+            dispatch.y = workgroupCountY;
+            dispatch.z = workgroupCountZ;
+            RecordPackableCommand(allocator, Command::Dispatch, dispatch);
 
             return {};
         },
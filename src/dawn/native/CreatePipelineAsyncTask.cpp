@@ -47,6 +47,7 @@ CreateComputePipelineAsyncTask::CreateComputePipelineAsyncTask(
     : mComputePipeline(std::move(nonInitializedComputePipeline)),
       mCallback(callback),
       mUserdata(userdata),
+      mPriority(mComputePipeline->GetDevice()->GetAsyncPipelineCreationPriority()),
       mScopedUseShaderPrograms(mComputePipeline->UseShaderPrograms()) {
     DAWN_ASSERT(mComputePipeline != nullptr);
 }
@@ -93,12 +94,13 @@ void CreateComputePipelineAsyncTask::RunAsync(
     // `AsyncTask` (`std::function`) from the lambda expression `asyncTask` because `asyncTask` is
     // non-copyable (it captures a `std::unique_ptr`), while `std::function` requires the callable
     // to be copyable.
+    dawn::platform::TaskPriority priority = task->mPriority;
     auto asyncTask = [taskPtr = task.release()] {
         std::unique_ptr<CreateComputePipelineAsyncTask> innnerTaskPtr(taskPtr);
         innnerTaskPtr->Run();
     };
 
-    device->GetAsyncTaskManager()->PostTask(std::move(asyncTask));
+    device->GetAsyncTaskManager()->PostTask(std::move(asyncTask), priority);
 }
 
 CreateRenderPipelineAsyncTask::CreateRenderPipelineAsyncTask(
@@ -108,6 +110,7 @@ CreateRenderPipelineAsyncTask::CreateRenderPipelineAsyncTask(
     : mRenderPipeline(std::move(nonInitializedRenderPipeline)),
       mCallback(callback),
       mUserdata(userdata),
+      mPriority(mRenderPipeline->GetDevice()->GetAsyncPipelineCreationPriority()),
       mScopedUseShaderPrograms(mRenderPipeline->UseShaderPrograms()) {
     DAWN_ASSERT(mRenderPipeline != nullptr);
 }
@@ -153,11 +156,12 @@ void CreateRenderPipelineAsyncTask::RunAsync(std::unique_ptr<CreateRenderPipelin
     // `AsyncTask` (`std::function`) from the lambda expression `asyncTask` because `asyncTask` is
     // non-copyable (it captures a `std::unique_ptr`), while `std::function` requires the callable
     // to be copyable.
+    dawn::platform::TaskPriority priority = task->mPriority;
     auto asyncTask = [taskPtr = task.release()] {
         std::unique_ptr<CreateRenderPipelineAsyncTask> innerTaskPtr(taskPtr);
         innerTaskPtr->Run();
     };
 
-    device->GetAsyncTaskManager()->PostTask(std::move(asyncTask));
+    device->GetAsyncTaskManager()->PostTask(std::move(asyncTask), priority);
 }
 }  // namespace dawn::native
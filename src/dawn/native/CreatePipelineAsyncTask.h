@@ -35,6 +35,7 @@
 #include "dawn/native/CallbackTaskManager.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/Pipeline.h"
+#include "dawn/platform/DawnPlatform.h"
 #include "dawn/webgpu.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
@@ -64,6 +65,8 @@ class CreateComputePipelineAsyncTask {
     Ref<ComputePipelineBase> mComputePipeline;
     WGPUCreateComputePipelineAsyncCallback mCallback;
     raw_ptr<void> mUserdata;
+    // The device's async pipeline creation priority when the pipeline was requested.
+    dawn::platform::TaskPriority mPriority;
     // Used to keep ShaderModuleBase::mTintProgram alive until pipeline initialization is done.
     PipelineBase::ScopedUseShaderPrograms mScopedUseShaderPrograms;
 };
@@ -85,6 +88,8 @@ class CreateRenderPipelineAsyncTask {
     Ref<RenderPipelineBase> mRenderPipeline;
     WGPUCreateRenderPipelineAsyncCallback mCallback;
     raw_ptr<void> mUserdata;
+    // The device's async pipeline creation priority when the pipeline was requested.
+    dawn::platform::TaskPriority mPriority;
     // Used to keep ShaderModuleBase::mTintProgram alive until pipeline initialization is done.
     PipelineBase::ScopedUseShaderPrograms mScopedUseShaderPrograms;
 };
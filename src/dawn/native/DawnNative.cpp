@@ -258,6 +258,10 @@ DAWN_NATIVE_EXPORT bool DeviceTick(WGPUDevice device) {
     return FromAPI(device)->APITick();
 }
 
+void SetAsyncPipelineCreationPriority(WGPUDevice device, dawn::platform::TaskPriority priority) {
+    FromAPI(device)->SetAsyncPipelineCreationPriority(priority);
+}
+
 DAWN_NATIVE_EXPORT bool InstanceProcessEvents(WGPUInstance instance) {
     return FromAPI(instance)->ProcessEvents();
 }
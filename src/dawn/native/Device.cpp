@@ -43,6 +43,7 @@
 #include "dawn/native/BlobCache.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/ChainUtils.h"
+#include "dawn/native/CommandAllocator.h"
 #include "dawn/native/CommandBuffer.h"
 #include "dawn/native/CommandEncoder.h"
 #include "dawn/native/CompilationMessages.h"
@@ -422,6 +423,7 @@ MaybeError DeviceBase::Initialize(Ref<QueueBase> defaultQueue) {
     mCaches = std::make_unique<DeviceBase::Caches>();
     mErrorScopeStack = std::make_unique<ErrorScopeStack>();
     mDynamicUploader = std::make_unique<DynamicUploader>(this);
+    mCommandBlockPool = std::make_unique<CommandBlockPool>();
     mCallbackTaskManager = AcquireRef(new CallbackTaskManager());
     mDeprecationWarnings = std::make_unique<DeprecationWarnings>();
     mInternalPipelineStore = std::make_unique<InternalPipelineStore>(this);
@@ -1186,12 +1188,12 @@ ResultOrError<Ref<ShaderModuleBase>> DeviceBase::GetOrCreateShaderModule(
         mCaches->shaderModules, &blueprint, [&]() -> ResultOrError<Ref<ShaderModuleBase>> {
             auto* unownedMessages = compilationMessages ? compilationMessages->get() : nullptr;
             if (!parseResult->HasParsedShader()) {
-                // We skip the parse on creation if validation isn't enabled which let's us quickly
-                // lookup in the cache without validating and parsing. We need the parsed module
-                // now.
-                DAWN_ASSERT(!IsValidationEnabled());
-                DAWN_TRY(
-                    ValidateAndParseShaderModule(this, descriptor, parseResult, unownedMessages));
+                // The shader is only parsed and validated once the lookup in the cache has missed,
+                // as a cached shader module with the same content has already been parsed and
+                // validated.
+                DAWN_TRY_CONTEXT(
+                    ValidateAndParseShaderModule(this, descriptor, parseResult, unownedMessages),
+                    "validating %s", *descriptor);
             }
 
             auto resultOrError = [&]() -> ResultOrError<Ref<ShaderModuleBase>> {
@@ -1600,6 +1602,11 @@ bool DeviceBase::APITick() {
 }
 
 MaybeError DeviceBase::Tick() {
+    // Free the command blocks that weren't needed since the last tick, including while idle.
+    if (mCommandBlockPool != nullptr) {
+        mCommandBlockPool->Trim();
+    }
+
     if (IsLost() || !mQueue->HasScheduledCommands()) {
         return {};
     }
@@ -2191,14 +2198,17 @@ ResultOrError<Ref<ShaderModuleBase>> DeviceBase::CreateShaderModule(
     if (IsValidationEnabled()) {
         DAWN_TRY_ASSIGN_CONTEXT(unpacked, ValidateAndUnpack(descriptor),
                                 "validating and unpacking %s", descriptor);
-        DAWN_TRY_CONTEXT(ValidateAndParseShaderModule(
-                             this, unpacked, &parseResult,
-                             compilationMessages ? compilationMessages->get() : nullptr),
-                         "validating %s", descriptor);
+        // The chain is validated before the cache lookup: it isn't part of the cached content, and
+        // the blueprint requires a WGSL or SPIR-V descriptor.
+        DAWN_TRY_CONTEXT(ValidateShaderModuleDescriptor(this, unpacked), "validating %s",
+                         descriptor);
     } else {
         unpacked = Unpack(descriptor);
     }
 
+    // The WGSL or SPIR-V is parsed and validated by GetOrCreateShaderModule() only when there is no
+    // cached shader module with the same content, so that creating a shader module that is already
+    // alive skips the Tint frontend.
     return GetOrCreateShaderModule(unpacked, &parseResult, compilationMessages);
 }
 
@@ -2285,6 +2295,10 @@ DynamicUploader* DeviceBase::GetDynamicUploader() const {
     return mDynamicUploader.get();
 }
 
+CommandBlockPool* DeviceBase::GetCommandBlockPool() const {
+    return mCommandBlockPool.get();
+}
+
 // The Toggle device facility
 
 std::vector<const char*> DeviceBase::GetTogglesUsed() const {
@@ -2339,6 +2353,14 @@ dawn::platform::WorkerTaskPool* DeviceBase::GetWorkerTaskPool() const {
     return mWorkerTaskPool.get();
 }
 
+void DeviceBase::SetAsyncPipelineCreationPriority(dawn::platform::TaskPriority priority) {
+    mAsyncPipelineCreationPriority.store(priority, std::memory_order_relaxed);
+}
+
+dawn::platform::TaskPriority DeviceBase::GetAsyncPipelineCreationPriority() const {
+    return mAsyncPipelineCreationPriority.load(std::memory_order_relaxed);
+}
+
 void DeviceBase::AddComputePipelineAsyncCallbackTask(
     std::unique_ptr<ErrorData> error,
     const char* label,
@@ -30,6 +30,7 @@
 
 #include <shared_mutex>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -53,6 +54,7 @@
 #include "dawn/native/RefCountedWithExternalCount.h"
 #include "dawn/native/Toggles.h"
 #include "dawn/native/UsageValidationMode.h"
+#include "dawn/platform/DawnPlatform.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
 #include "dawn/native/DawnNative.h"
@@ -69,6 +71,7 @@ class AttachmentStateBlueprint;
 class Blob;
 class BlobCache;
 class CallbackTaskManager;
+class CommandBlockPool;
 class DynamicUploader;
 class ErrorScopeStack;
 class SharedTextureMemory;
@@ -314,6 +317,7 @@ class DeviceBase : public ErrorSink, public RefCountedWithExternalCount {
                                         const Extent3D& copySizePixels);
 
     DynamicUploader* GetDynamicUploader() const;
+    CommandBlockPool* GetCommandBlockPool() const;
 
     // The device state which is a combination of creation state and loss state.
     //
@@ -397,6 +401,11 @@ class DeviceBase : public ErrorSink, public RefCountedWithExternalCount {
     CallbackTaskManager* GetCallbackTaskManager() const;
     dawn::platform::WorkerTaskPool* GetWorkerTaskPool() const;
 
+    // The priority of the worker tasks posted by CreateComputePipelineAsync() and
+    // CreateRenderPipelineAsync().
+    void SetAsyncPipelineCreationPriority(dawn::platform::TaskPriority priority);
+    dawn::platform::TaskPriority GetAsyncPipelineCreationPriority() const;
+
     // Enqueue a successfully-create async pipeline creation callback.
     void AddComputePipelineAsyncCallbackTask(Ref<ComputePipelineBase> pipeline,
                                              WGPUCreateComputePipelineAsyncCallback callback,
@@ -557,6 +566,10 @@ class DeviceBase : public ErrorSink, public RefCountedWithExternalCount {
 
     Ref<AdapterBase> mAdapter;
 
+    // Declared before the objects that can hold command blocks so that it is destroyed after
+    // them. Not released in Destroy() since command buffers may outlive it.
+    std::unique_ptr<CommandBlockPool> mCommandBlockPool;
+
     // The object caches aren't exposed in the header as they would require a lot of
     // additional includes.
     struct Caches;
@@ -598,6 +611,9 @@ class DeviceBase : public ErrorSink, public RefCountedWithExternalCount {
 
     // Ensure `mAsyncTaskManager` is always destroyed before mWorkerTaskPool
     std::unique_ptr<AsyncTaskManager> mAsyncTaskManager;
+    // Set from any thread by the embedder, so it is read without locking the device.
+    std::atomic<dawn::platform::TaskPriority> mAsyncPipelineCreationPriority{
+        dawn::platform::TaskPriority::Normal};
     std::string mLabel;
 
     CacheKey mDeviceCacheKey;
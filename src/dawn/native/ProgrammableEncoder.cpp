@@ -46,7 +46,8 @@ ProgrammableEncoder::ProgrammableEncoder(DeviceBase* device,
                                          EncodingContext* encodingContext)
     : ApiObjectBase(device, label),
       mEncodingContext(encodingContext),
-      mValidationEnabled(device->IsValidationEnabled()) {}
+      mValidationEnabled(device->IsValidationEnabled()),
+      mUsePackedCommandEncoding(device->IsToggleEnabled(Toggle::UsePackedCommandEncoding)) {}
 
 ProgrammableEncoder::ProgrammableEncoder(DeviceBase* device,
                                          EncodingContext* encodingContext,
@@ -54,7 +55,8 @@ ProgrammableEncoder::ProgrammableEncoder(DeviceBase* device,
                                          const char* label)
     : ApiObjectBase(device, errorTag, label),
       mEncodingContext(encodingContext),
-      mValidationEnabled(device->IsValidationEnabled()) {}
+      mValidationEnabled(device->IsValidationEnabled()),
+      mUsePackedCommandEncoding(device->IsToggleEnabled(Toggle::UsePackedCommandEncoding)) {}
 
 bool ProgrammableEncoder::IsValidationEnabled() const {
     return mValidationEnabled;
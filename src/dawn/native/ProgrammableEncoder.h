@@ -31,6 +31,7 @@
 #include <string>
 
 #include "dawn/native/CommandEncoder.h"
+#include "dawn/native/Commands.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/Forward.h"
 #include "dawn/native/IntegerTypes.h"
@@ -68,6 +69,17 @@ class ProgrammableEncoder : public ApiObjectBase {
                             uint32_t dynamicOffsetCount,
                             const uint32_t* dynamicOffsets) const;
 
+    // Records a command that has PackedCommandTraits, packed if the device uses the packed
+    // command encoding.
+    template <typename T>
+    void RecordPackableCommand(CommandAllocator* allocator, Command commandId, const T& cmd) const {
+        if (mUsePackedCommandEncoding) {
+            allocator->AllocatePacked(commandId, cmd);
+        } else {
+            *allocator->Allocate<T>(commandId) = cmd;
+        }
+    }
+
     // Construct an "error" programmable pass encoder.
     ProgrammableEncoder(DeviceBase* device,
                         EncodingContext* encodingContext,
@@ -82,6 +94,7 @@ class ProgrammableEncoder : public ApiObjectBase {
 
   private:
     const bool mValidationEnabled;
+    const bool mUsePackedCommandEncoding;
 };
 
 }  // namespace dawn::native
@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -236,6 +237,100 @@ struct WorkDoneEvent final : public EventManager::TrackedEvent {
     }
 };
 
+MaybeError ValidateCommandBufferForSubmit(const DeviceBase* device,
+                                          const CommandBufferBase* commandBuffer) {
+    DAWN_TRY(device->ValidateObject(commandBuffer));
+    DAWN_TRY(commandBuffer->ValidateCanUseInSubmitNow());
+    const CommandBufferResourceUsage& usages = commandBuffer->GetResourceUsages();
+
+    for (const BufferBase* buffer : usages.topLevelBuffers) {
+        DAWN_TRY(buffer->ValidateCanUseOnQueueNow());
+    }
+
+    // Maybe track last usage for other resources, and use it to release resources earlier?
+    for (const SyncScopeResourceUsage& scope : usages.renderPasses) {
+        for (const BufferBase* buffer : scope.buffers) {
+            DAWN_TRY(buffer->ValidateCanUseOnQueueNow());
+        }
+
+        for (const TextureBase* texture : scope.textures) {
+            DAWN_TRY(texture->ValidateCanUseInSubmitNow());
+        }
+
+        for (const ExternalTextureBase* externalTexture : scope.externalTextures) {
+            DAWN_TRY(externalTexture->ValidateCanUseInSubmitNow());
+        }
+    }
+
+    for (const ComputePassResourceUsage& pass : usages.computePasses) {
+        for (const BufferBase* buffer : pass.referencedBuffers) {
+            DAWN_TRY(buffer->ValidateCanUseOnQueueNow());
+        }
+        for (const TextureBase* texture : pass.referencedTextures) {
+            DAWN_TRY(texture->ValidateCanUseInSubmitNow());
+        }
+        for (const ExternalTextureBase* externalTexture : pass.referencedExternalTextures) {
+            DAWN_TRY(externalTexture->ValidateCanUseInSubmitNow());
+        }
+    }
+
+    for (const TextureBase* texture : usages.topLevelTextures) {
+        DAWN_TRY(texture->ValidateCanUseInSubmitNow());
+    }
+    for (const QuerySetBase* querySet : usages.usedQuerySets) {
+        DAWN_TRY(querySet->ValidateCanUseInSubmitNow());
+    }
+
+    return {};
+}
+
+// Validates each command buffer in its own worker task. The calling thread validates the first
+// command buffer and then waits for the others. The error reported is the one of the first invalid
+// command buffer, like with the serial validation. The tasks only read the state of the objects,
+// which no other API call can change during the submit. Waiting runs the tasks that no worker has
+// picked up yet, so this makes progress even if all the workers are busy.
+MaybeError ValidateCommandBuffersForSubmitInParallel(const DeviceBase* device,
+                                                     uint32_t commandCount,
+                                                     CommandBufferBase* const* commands) {
+    struct ValidationTask {
+        raw_ptr<const DeviceBase> device;
+        raw_ptr<const CommandBufferBase> commandBuffer;
+        std::unique_ptr<ErrorData> error;
+        std::unique_ptr<dawn::platform::WaitableEvent> waitableEvent;
+
+        static void Run(void* userdata) {
+            ValidationTask* task = static_cast<ValidationTask*>(userdata);
+            MaybeError result = ValidateCommandBufferForSubmit(task->device, task->commandBuffer);
+            if (result.IsError()) {
+                task->error = result.AcquireError();
+            }
+        }
+    };
+
+    std::vector<ValidationTask> tasks(commandCount);
+    for (uint32_t i = 0; i < commandCount; ++i) {
+        tasks[i].device = device;
+        tasks[i].commandBuffer = commands[i];
+    }
+    for (uint32_t i = 1; i < commandCount; ++i) {
+        tasks[i].waitableEvent = device->GetWorkerTaskPool()->PostWorkerTaskWithPriority(
+            ValidationTask::Run, &tasks[i], dawn::platform::TaskPriority::High);
+    }
+
+    // The tasks reference |tasks| so they must all complete before returning, even on errors.
+    ValidationTask::Run(&tasks[0]);
+    for (uint32_t i = 1; i < commandCount; ++i) {
+        tasks[i].waitableEvent->Wait();
+    }
+
+    for (ValidationTask& task : tasks) {
+        if (task.error != nullptr) {
+            return std::move(task.error);
+        }
+    }
+    return {};
+}
+
 }  // namespace
 
 // TrackTaskCallback
@@ -577,48 +672,11 @@ MaybeError QueueBase::ValidateSubmit(uint32_t commandCount,
     TRACE_EVENT0(GetDevice()->GetPlatform(), Validation, "Queue::ValidateSubmit");
     DAWN_TRY(GetDevice()->ValidateObject(this));
 
+    if (commandCount > 1 && GetDevice()->IsToggleEnabled(Toggle::ParallelSubmitValidation)) {
+        return ValidateCommandBuffersForSubmitInParallel(GetDevice(), commandCount, commands);
+    }
     for (uint32_t i = 0; i < commandCount; ++i) {
-        DAWN_TRY(GetDevice()->ValidateObject(commands[i]));
-        DAWN_TRY(commands[i]->ValidateCanUseInSubmitNow());
-        const CommandBufferResourceUsage& usages = commands[i]->GetResourceUsages();
-
-        for (const BufferBase* buffer : usages.topLevelBuffers) {
-            DAWN_TRY(buffer->ValidateCanUseOnQueueNow());
-        }
-
-        // Maybe track last usage for other resources, and use it to release resources earlier?
-        for (const SyncScopeResourceUsage& scope : usages.renderPasses) {
-            for (const BufferBase* buffer : scope.buffers) {
-                DAWN_TRY(buffer->ValidateCanUseOnQueueNow());
-            }
-
-            for (const TextureBase* texture : scope.textures) {
-                DAWN_TRY(texture->ValidateCanUseInSubmitNow());
-            }
-
-            for (const ExternalTextureBase* externalTexture : scope.externalTextures) {
-                DAWN_TRY(externalTexture->ValidateCanUseInSubmitNow());
-            }
-        }
-
-        for (const ComputePassResourceUsage& pass : usages.computePasses) {
-            for (const BufferBase* buffer : pass.referencedBuffers) {
-                DAWN_TRY(buffer->ValidateCanUseOnQueueNow());
-            }
-            for (const TextureBase* texture : pass.referencedTextures) {
-                DAWN_TRY(texture->ValidateCanUseInSubmitNow());
-            }
-            for (const ExternalTextureBase* externalTexture : pass.referencedExternalTextures) {
-                DAWN_TRY(externalTexture->ValidateCanUseInSubmitNow());
-            }
-        }
-
-        for (const TextureBase* texture : usages.topLevelTextures) {
-            DAWN_TRY(texture->ValidateCanUseInSubmitNow());
-        }
-        for (const QuerySetBase* querySet : usages.usedQuerySets) {
-            DAWN_TRY(querySet->ValidateCanUseInSubmitNow());
-        }
+        DAWN_TRY(ValidateCommandBufferForSubmit(GetDevice(), commands[i]));
     }
 
     return {};
@@ -130,11 +130,12 @@ void RenderEncoderBase::APIDraw(uint32_t vertexCount,
                                                                                     firstInstance));
             }
 
-            DrawCmd* draw = allocator->Allocate<DrawCmd>(Command::Draw);
-            draw->vertexCount = vertexCount;
-            draw->instanceCount = instanceCount;
-            draw->firstVertex = firstVertex;
-            draw->firstInstance = firstInstance;
+            DrawCmd draw;
+            draw.vertexCount = vertexCount;
+            draw.instanceCount = instanceCount;
+            draw.firstVertex = firstVertex;
+            draw.firstInstance = firstInstance;
+            RecordPackableCommand(allocator, Command::Draw, draw);
 
             mDrawCount++;
 
@@ -181,12 +182,13 @@ void RenderEncoderBase::APIDrawIndexed(uint32_t indexCount,
                                                                                     firstInstance));
             }
 
-            DrawIndexedCmd* draw = allocator->Allocate<DrawIndexedCmd>(Command::DrawIndexed);
-            draw->indexCount = indexCount;
-            draw->instanceCount = instanceCount;
-            draw->firstIndex = firstIndex;
-            draw->baseVertex = baseVertex;
-            draw->firstInstance = firstInstance;
+            DrawIndexedCmd draw;
+            draw.indexCount = indexCount;
+            draw.instanceCount = instanceCount;
+            draw.firstIndex = firstIndex;
+            draw.baseVertex = baseVertex;
+            draw.firstInstance = firstInstance;
+            RecordPackableCommand(allocator, Command::DrawIndexed, draw);
 
             mDrawCount++;
 
@@ -1043,12 +1043,9 @@ bool ShaderModuleParseResult::HasParsedShader() const {
     return tintProgram != nullptr;
 }
 
-MaybeError ValidateAndParseShaderModule(DeviceBase* device,
-                                        const UnpackedPtr<ShaderModuleDescriptor>& descriptor,
-                                        ShaderModuleParseResult* parseResult,
-                                        OwnedCompilationMessages* outMessages) {
-    DAWN_ASSERT(parseResult != nullptr);
-
+ResultOrError<wgpu::SType> ValidateShaderModuleDescriptor(
+    DeviceBase* device,
+    const UnpackedPtr<ShaderModuleDescriptor>& descriptor) {
     wgpu::SType moduleType;
     // A WGSL (or SPIR-V, if enabled) subdescriptor is required, and a Dawn-specific SPIR-V options
 // descriptor is allowed when using SPIR-V.
@@ -1064,6 +1061,22 @@ MaybeError ValidateAndParseShaderModule(DeviceBase* device,
 #endif
     DAWN_ASSERT(moduleType != wgpu::SType::Invalid);
 
+    DAWN_INVALID_IF(moduleType == wgpu::SType::ShaderModuleSPIRVDescriptor &&
+                        device->IsToggleEnabled(Toggle::DisallowSpirv),
+                    "SPIR-V is disallowed.");
+
+    return moduleType;
+}
+
+MaybeError ValidateAndParseShaderModule(DeviceBase* device,
+                                        const UnpackedPtr<ShaderModuleDescriptor>& descriptor,
+                                        ShaderModuleParseResult* parseResult,
+                                        OwnedCompilationMessages* outMessages) {
+    DAWN_ASSERT(parseResult != nullptr);
+
+    wgpu::SType moduleType;
+    DAWN_TRY_ASSIGN(moduleType, ValidateShaderModuleDescriptor(device, descriptor));
+
     ScopedTintICEHandler scopedICEHandler(device);
 
     // Multiple paths may use a WGSL descriptor so declare it here now.
@@ -1076,8 +1089,6 @@ MaybeError ValidateAndParseShaderModule(DeviceBase* device,
     switch (moduleType) {
 #if TINT_BUILD_SPV_READER
         case wgpu::SType::ShaderModuleSPIRVDescriptor: {
-            DAWN_INVALID_IF(device->IsToggleEnabled(Toggle::DisallowSpirv),
-                            "SPIR-V is disallowed.");
             const auto* spirvDesc = descriptor.Get<ShaderModuleSPIRVDescriptor>();
             const auto* spirvOptions = descriptor.Get<DawnShaderModuleSPIRVOptionsDescriptor>();
 
@@ -130,6 +130,11 @@ struct ShaderModuleEntryPoint {
     std::string name;
 };
 
+// Validates the chain of |descriptor| and returns the sType of its WGSL or SPIR-V descriptor. This
+// doesn't look at the shader code.
+ResultOrError<wgpu::SType> ValidateShaderModuleDescriptor(
+    DeviceBase* device,
+    const UnpackedPtr<ShaderModuleDescriptor>& descriptor);
 MaybeError ValidateAndParseShaderModule(DeviceBase* device,
                                         const UnpackedPtr<ShaderModuleDescriptor>& descriptor,
                                         ShaderModuleParseResult* parseResult,
@@ -28,6 +28,7 @@
 #ifndef SRC_DAWN_NATIVE_SUBRESOURCESTORAGE_H_
 #define SRC_DAWN_NATIVE_SUBRESOURCESTORAGE_H_
 
+#include <algorithm>
 #include <array>
 #include <limits>
 #include <memory>
@@ -101,6 +102,13 @@ namespace dawn::native {
 // SubresourceStorage contains an inline array that contains the per-aspect compressed data
 // and only allocates a per-subresource on aspect decompression.
 //
+// For textures with many array layers the dense per-layer storage of a decompressed aspect makes
+// Update(), Merge() and Iterate() O(layers x levels) even when only a few layers differ. In the
+// LayerRanges mode a decompressed aspect is instead a sorted list of ranges of consecutive layers
+// that have the same data, each range having either a single value or one value per mip level.
+// Operations are then proportional to the number of distinct ranges. The mode is chosen at
+// construction, by default based on the number of array layers.
+//
 // T must be a copyable type that supports equality comparison with ==.
 //
 // The implementation of functions in this file can have a lot of control flow and corner cases
@@ -118,6 +126,16 @@ namespace dawn::native {
 //
 // TODO(crbug.com/dawn/836): Make the recompression optional, the calling code should know
 // if recompression can happen or not in Update() and Merge()
+enum class SubresourceStorageMode : uint8_t {
+    // Decompressed aspects store a value per subresource, with per-layer compression.
+    PerLayer,
+    // Decompressed aspects store a value per range of layers with the same data.
+    LayerRanges,
+};
+
+// Storages for textures with at least this many array layers use the LayerRanges mode by default.
+constexpr uint32_t kMinArrayLayerCountForLayerRanges = 64;
+
 template <typename T>
 class SubresourceStorage {
   public:
@@ -130,6 +148,11 @@ class SubresourceStorage {
                        uint32_t arrayLayerCount,
                        uint32_t mipLevelCount,
                        const T& initialValue = {});
+    SubresourceStorage(SubresourceStorageMode mode,
+                       Aspect aspects,
+                       uint32_t arrayLayerCount,
+                       uint32_t mipLevelCount,
+                       const T& initialValue = {});
 
     // Returns the data for a single subresource. Note that the reference returned might be the
     // same for multiple subresources.
@@ -198,6 +221,7 @@ class SubresourceStorage {
     //  - UpdateTo(Range, T) that updates the range to a constant value.
 
     // Methods to query the internal state of SubresourceStorage for testing.
+    SubresourceStorageMode GetModeForTesting() const;
     Aspect GetAspectsForTesting() const;
     uint32_t GetArrayLayerCountForTesting() const;
     uint32_t GetMipLevelCountForTesting() const;
@@ -216,6 +240,33 @@ class SubresourceStorage {
 
     SubresourceRange GetFullLayerRange(Aspect aspect, uint32_t layer) const;
 
+    // A range of layers of a decompressed aspect in the LayerRanges mode. It ends where the next
+    // run of the aspect starts, or at mArrayLayerCount for the last one.
+    struct LayerRun {
+        uint32_t baseArrayLayer;
+        // The data of all the levels when perLevelData is null.
+        T data;
+        // The data of each level, only allocated when they aren't all the same.
+        std::unique_ptr<T[]> perLevelData;
+    };
+
+    template <typename F>
+    void UpdateLayerRuns(Aspect aspect,
+                         uint32_t aspectIndex,
+                         const SubresourceRange& range,
+                         F&& updateFunc);
+    std::vector<LayerRun>& LayerRuns(uint32_t aspectIndex);
+    const std::vector<LayerRun>& LayerRuns(uint32_t aspectIndex) const;
+    size_t FindLayerRun(uint32_t aspectIndex, uint32_t layer) const;
+    uint32_t GetLayerRunEnd(uint32_t aspectIndex, size_t runIndex) const;
+    // Splits the run containing `layer` so that a run starts at `layer`, and returns its index.
+    size_t SplitLayerRunAt(uint32_t aspectIndex, uint32_t layer);
+    // Merges the runs in [begin - 1, end] that are next to each other and have the same data.
+    void CoalesceLayerRuns(uint32_t aspectIndex, size_t begin, size_t end);
+    void DecompressLayerRun(LayerRun* run);
+    void RecompressLayerRun(LayerRun* run);
+    bool LayerRunsHaveSameData(const LayerRun& a, const LayerRun& b) const;
+
     // LayerCompressed should never be called when the aspect is compressed otherwise it would
     // need to check that mLayerCompressed is not null before indexing it.
     bool& LayerCompressed(uint32_t aspectIndex, uint32_t layerIndex);
@@ -229,6 +280,7 @@ class SubresourceStorage {
     const T& Data(uint32_t aspectIndex, uint32_t layer, uint32_t level = 0) const;
 
     Aspect mAspects;
+    SubresourceStorageMode mMode;
     uint8_t mMipLevelCount;
     uint16_t mArrayLayerCount;
 
@@ -245,6 +297,10 @@ class SubresourceStorage {
     // The data for a compressed aspect is stored in the slot for (aspect, 0, 0). Similarly
     // the data for a compressed layer of aspect if in the slot for (aspect, layer, 0).
     std::unique_ptr<T[]> mData;
+
+    // Indexed by aspectIndex, only used in the LayerRanges mode. The runs of a decompressed
+    // aspect are sorted and cover all its layers.
+    std::unique_ptr<std::vector<LayerRun>[]> mLayerRuns;
 };
 
 template <typename T>
@@ -252,7 +308,24 @@ SubresourceStorage<T>::SubresourceStorage(Aspect aspects,
                                           uint32_t arrayLayerCount,
                                           uint32_t mipLevelCount,
                                           const T& initialValue)
-    : mAspects(aspects), mMipLevelCount(mipLevelCount), mArrayLayerCount(arrayLayerCount) {
+    : SubresourceStorage(arrayLayerCount >= kMinArrayLayerCountForLayerRanges
+                             ? SubresourceStorageMode::LayerRanges
+                             : SubresourceStorageMode::PerLayer,
+                         aspects,
+                         arrayLayerCount,
+                         mipLevelCount,
+                         initialValue) {}
+
+template <typename T>
+SubresourceStorage<T>::SubresourceStorage(SubresourceStorageMode mode,
+                                          Aspect aspects,
+                                          uint32_t arrayLayerCount,
+                                          uint32_t mipLevelCount,
+                                          const T& initialValue)
+    : mAspects(aspects),
+      mMode(mode),
+      mMipLevelCount(mipLevelCount),
+      mArrayLayerCount(arrayLayerCount) {
     DAWN_ASSERT(arrayLayerCount <= std::numeric_limits<decltype(mArrayLayerCount)>::max());
     DAWN_ASSERT(mipLevelCount <= std::numeric_limits<decltype(mMipLevelCount)>::max());
 
@@ -268,6 +341,13 @@ void SubresourceStorage<T>::Fill(const T& value) {
         mAspectCompressed[aspectIndex] = true;
         DataInline(aspectIndex) = value;
     }
+
+    // Free the per-level data of the runs.
+    if (mLayerRuns != nullptr) {
+        for (uint32_t aspectIndex = 0; aspectIndex < aspectCount; aspectIndex++) {
+            mLayerRuns[aspectIndex].clear();
+        }
+    }
 }
 
 template <typename T>
@@ -297,6 +377,13 @@ void SubresourceStorage<T>::Update(const SubresourceRange& range, F&& updateFunc
             DecompressAspect(aspectIndex);
         }
 
+        if (mMode == SubresourceStorageMode::LayerRanges) {
+            UpdateLayerRuns(aspect, aspectIndex, range, updateFunc);
+            // Checking if the aspect can be recompressed is O(1) for layer runs.
+            RecompressAspect(aspectIndex);
+            continue;
+        }
+
         uint32_t layerEnd = range.baseArrayLayer + range.layerCount;
         for (uint32_t layer = range.baseArrayLayer; layer < layerEnd; layer++) {
             // Call the updateFunc once for the whole layer if possible or decompress and
@@ -340,6 +427,19 @@ void SubresourceStorage<T>::Merge(const SubresourceStorage<U>& other, F&& mergeF
     DAWN_ASSERT(mArrayLayerCount == other.mArrayLayerCount);
     DAWN_ASSERT(mMipLevelCount == other.mMipLevelCount);
 
+    // When either storage uses layer runs, merge each range of `other` that has constant data
+    // with an Update() so that the merge is proportional to the number of ranges instead of
+    // decompressing to individual subresources.
+    if (mMode != SubresourceStorageMode::PerLayer ||
+        other.mMode != SubresourceStorageMode::PerLayer) {
+        other.Iterate([&](const SubresourceRange& otherRange, const U& otherData) {
+            Update(otherRange, [&](const SubresourceRange& subrange, T* data) {
+                mergeFunc(subrange, data, otherData);
+            });
+        });
+        return;
+    }
+
     for (Aspect aspect : IterateEnumMask(mAspects)) {
         uint32_t aspectIndex = GetAspectIndex(aspect);
 
@@ -411,6 +511,36 @@ R SubresourceStorage<T>::Iterate(F&& iterateFunc) const {
             continue;
         }
 
+        if (mMode == SubresourceStorageMode::LayerRanges) {
+            const std::vector<LayerRun>& runs = LayerRuns(aspectIndex);
+            for (size_t i = 0; i < runs.size(); i++) {
+                const LayerRun& run = runs[i];
+                FirstAndCountRange<uint32_t> layers = {
+                    run.baseArrayLayer, GetLayerRunEnd(aspectIndex, i) - run.baseArrayLayer};
+
+                // Fast path, call iterateFunc on the whole run at once.
+                if (run.perLevelData == nullptr) {
+                    SubresourceRange range(aspect, layers, {0, mMipLevelCount});
+                    if constexpr (mayError) {
+                        DAWN_TRY(iterateFunc(range, run.data));
+                    } else {
+                        iterateFunc(range, run.data);
+                    }
+                    continue;
+                }
+
+                for (uint32_t level = 0; level < mMipLevelCount; level++) {
+                    SubresourceRange range(aspect, layers, {level, 1});
+                    if constexpr (mayError) {
+                        DAWN_TRY(iterateFunc(range, run.perLevelData[level]));
+                    } else {
+                        iterateFunc(range, run.perLevelData[level]);
+                    }
+                }
+            }
+            continue;
+        }
+
         for (uint32_t layer = 0; layer < mArrayLayerCount; layer++) {
             // Fast path, call iterateFunc on the whole array layer at once.
             if (LayerCompressed(aspectIndex, layer)) {
@@ -451,6 +581,11 @@ const T& SubresourceStorage<T>::Get(Aspect aspect, uint32_t arrayLayer, uint32_t
         return DataInline(aspectIndex);
     }
 
+    if (mMode == SubresourceStorageMode::LayerRanges) {
+        const LayerRun& run = LayerRuns(aspectIndex)[FindLayerRun(aspectIndex, arrayLayer)];
+        return run.perLevelData == nullptr ? run.data : run.perLevelData[mipLevel];
+    }
+
     // Fast path, the array layer is compressed.
     if (LayerCompressed(aspectIndex, arrayLayer)) {
         return Data(aspectIndex, arrayLayer);
@@ -459,6 +594,11 @@ const T& SubresourceStorage<T>::Get(Aspect aspect, uint32_t arrayLayer, uint32_t
     return Data(aspectIndex, arrayLayer, mipLevel);
 }
 
+template <typename T>
+SubresourceStorageMode SubresourceStorage<T>::GetModeForTesting() const {
+    return mMode;
+}
+
 template <typename T>
 Aspect SubresourceStorage<T>::GetAspectsForTesting() const {
     return mAspects;
@@ -481,8 +621,14 @@ bool SubresourceStorage<T>::IsAspectCompressedForTesting(Aspect aspect) const {
 
 template <typename T>
 bool SubresourceStorage<T>::IsLayerCompressedForTesting(Aspect aspect, uint32_t layer) const {
-    return mAspectCompressed[GetAspectIndex(aspect)] ||
-           mLayerCompressed[GetAspectIndex(aspect) * mArrayLayerCount + layer];
+    uint32_t aspectIndex = GetAspectIndex(aspect);
+    if (mAspectCompressed[aspectIndex]) {
+        return true;
+    }
+    if (mMode == SubresourceStorageMode::LayerRanges) {
+        return LayerRuns(aspectIndex)[FindLayerRun(aspectIndex, layer)].perLevelData == nullptr;
+    }
+    return mLayerCompressed[aspectIndex * mArrayLayerCount + layer];
 }
 
 template <typename T>
@@ -491,6 +637,16 @@ void SubresourceStorage<T>::DecompressAspect(uint32_t aspectIndex) {
     const T& aspectData = DataInline(aspectIndex);
     mAspectCompressed[aspectIndex] = false;
 
+    if (mMode == SubresourceStorageMode::LayerRanges) {
+        if (mLayerRuns == nullptr) {
+            mLayerRuns = std::make_unique<std::vector<LayerRun>[]>(GetAspectCount(mAspects));
+        }
+        std::vector<LayerRun>& runs = LayerRuns(aspectIndex);
+        DAWN_ASSERT(runs.empty());
+        runs.push_back({0, aspectData, nullptr});
+        return;
+    }
+
     // Extra allocations are only needed when aspects are decompressed. Create them lazily.
     if (mData == nullptr) {
         DAWN_ASSERT(mLayerCompressed == nullptr);
@@ -514,6 +670,17 @@ void SubresourceStorage<T>::DecompressAspect(uint32_t aspectIndex) {
 template <typename T>
 void SubresourceStorage<T>::RecompressAspect(uint32_t aspectIndex) {
     DAWN_ASSERT(!mAspectCompressed[aspectIndex]);
+
+    if (mMode == SubresourceStorageMode::LayerRanges) {
+        std::vector<LayerRun>& runs = LayerRuns(aspectIndex);
+        if (runs.size() == 1 && runs[0].perLevelData == nullptr) {
+            mAspectCompressed[aspectIndex] = true;
+            DataInline(aspectIndex) = runs[0].data;
+            runs.clear();
+        }
+        return;
+    }
+
     // All layers of the aspect must be compressed for the aspect to possibly recompress.
     for (uint32_t layer = 0; layer < mArrayLayerCount; layer++) {
         if (!LayerCompressed(aspectIndex, layer)) {
@@ -566,6 +733,165 @@ SubresourceRange SubresourceStorage<T>::GetFullLayerRange(Aspect aspect, uint32_
     return {aspect, {layer, 1}, {0, mMipLevelCount}};
 }
 
+template <typename T>
+template <typename F>
+void SubresourceStorage<T>::UpdateLayerRuns(Aspect aspect,
+                                            uint32_t aspectIndex,
+                                            const SubresourceRange& range,
+                                            F&& updateFunc) {
+    bool fullLayers = range.baseMipLevel == 0 && range.levelCount == mMipLevelCount;
+
+    // Split runs so that the range is made of whole runs. Splitting at the end of the range only
+    // inserts runs after runBegin so it stays valid.
+    size_t runBegin = SplitLayerRunAt(aspectIndex, range.baseArrayLayer);
+    size_t runEnd = SplitLayerRunAt(aspectIndex, range.baseArrayLayer + range.layerCount);
+
+    std::vector<LayerRun>& runs = LayerRuns(aspectIndex);
+    for (size_t i = runBegin; i < runEnd; i++) {
+        LayerRun& run = runs[i];
+        FirstAndCountRange<uint32_t> layers = {run.baseArrayLayer,
+                                               GetLayerRunEnd(aspectIndex, i) - run.baseArrayLayer};
+
+        // Call the updateFunc once for the whole run if possible or decompress and fallback to
+        // per-level handling.
+        if (run.perLevelData == nullptr) {
+            if (fullLayers) {
+                SubresourceRange updateRange(aspect, layers, {0, mMipLevelCount});
+                updateFunc(updateRange, &run.data);
+                continue;
+            }
+            DecompressLayerRun(&run);
+        }
+
+        uint32_t levelEnd = range.baseMipLevel + range.levelCount;
+        for (uint32_t level = range.baseMipLevel; level < levelEnd; level++) {
+            SubresourceRange updateRange(aspect, layers, {level, 1});
+            updateFunc(updateRange, &run.perLevelData[level]);
+        }
+        RecompressLayerRun(&run);
+    }
+
+    CoalesceLayerRuns(aspectIndex, runBegin, runEnd);
+}
+
+template <typename T>
+std::vector<typename SubresourceStorage<T>::LayerRun>& SubresourceStorage<T>::LayerRuns(
+    uint32_t aspectIndex) {
+    DAWN_ASSERT(mMode == SubresourceStorageMode::LayerRanges);
+    DAWN_ASSERT(!mAspectCompressed[aspectIndex]);
+    return mLayerRuns[aspectIndex];
+}
+
+template <typename T>
+const std::vector<typename SubresourceStorage<T>::LayerRun>& SubresourceStorage<T>::LayerRuns(
+    uint32_t aspectIndex) const {
+    DAWN_ASSERT(mMode == SubresourceStorageMode::LayerRanges);
+    DAWN_ASSERT(!mAspectCompressed[aspectIndex]);
+    return mLayerRuns[aspectIndex];
+}
+
+template <typename T>
+size_t SubresourceStorage<T>::FindLayerRun(uint32_t aspectIndex, uint32_t layer) const {
+    DAWN_ASSERT(layer < mArrayLayerCount);
+    const std::vector<LayerRun>& runs = LayerRuns(aspectIndex);
+    auto it = std::upper_bound(
+        runs.begin(), runs.end(), layer,
+        [](uint32_t layer, const LayerRun& run) { return layer < run.baseArrayLayer; });
+    DAWN_ASSERT(it != runs.begin());
+    return static_cast<size_t>(it - runs.begin()) - 1;
+}
+
+template <typename T>
+uint32_t SubresourceStorage<T>::GetLayerRunEnd(uint32_t aspectIndex, size_t runIndex) const {
+    const std::vector<LayerRun>& runs = LayerRuns(aspectIndex);
+    return runIndex + 1 < runs.size() ? runs[runIndex + 1].baseArrayLayer : mArrayLayerCount;
+}
+
+template <typename T>
+size_t SubresourceStorage<T>::SplitLayerRunAt(uint32_t aspectIndex, uint32_t layer) {
+    std::vector<LayerRun>& runs = LayerRuns(aspectIndex);
+    if (layer == mArrayLayerCount) {
+        return runs.size();
+    }
+
+    size_t index = FindLayerRun(aspectIndex, layer);
+    if (runs[index].baseArrayLayer == layer) {
+        return index;
+    }
+
+    LayerRun split = {layer, runs[index].data, nullptr};
+    if (runs[index].perLevelData != nullptr) {
+        split.perLevelData = std::make_unique<T[]>(mMipLevelCount);
+        std::copy(runs[index].perLevelData.get(), runs[index].perLevelData.get() + mMipLevelCount,
+                  split.perLevelData.get());
+    }
+    runs.insert(runs.begin() + index + 1, std::move(split));
+    return index + 1;
+}
+
+template <typename T>
+void SubresourceStorage<T>::CoalesceLayerRuns(uint32_t aspectIndex, size_t begin, size_t end) {
+    std::vector<LayerRun>& runs = LayerRuns(aspectIndex);
+    size_t first = std::max(begin, size_t(1));
+    size_t last = std::min(end, runs.size() - 1);
+    if (first > last) {
+        return;
+    }
+
+    // Compact the runs in place so that a single erase() is needed. A run merged into the
+    // previous one extends it since the previous one keeps its baseArrayLayer.
+    size_t write = first - 1;
+    for (size_t read = first; read <= last; read++) {
+        if (LayerRunsHaveSameData(runs[write], runs[read])) {
+            continue;
+        }
+        write++;
+        if (write != read) {
+            runs[write] = std::move(runs[read]);
+        }
+    }
+    runs.erase(runs.begin() + write + 1, runs.begin() + last + 1);
+}
+
+template <typename T>
+void SubresourceStorage<T>::DecompressLayerRun(LayerRun* run) {
+    DAWN_ASSERT(run->perLevelData == nullptr);
+    run->perLevelData = std::make_unique<T[]>(mMipLevelCount);
+    for (uint32_t level = 0; level < mMipLevelCount; level++) {
+        run->perLevelData[level] = run->data;
+    }
+}
+
+template <typename T>
+void SubresourceStorage<T>::RecompressLayerRun(LayerRun* run) {
+    DAWN_ASSERT(run->perLevelData != nullptr);
+    for (uint32_t level = 1; level < mMipLevelCount; level++) {
+        if (!(run->perLevelData[level] == run->perLevelData[0])) {
+            return;
+        }
+    }
+    run->data = run->perLevelData[0];
+    run->perLevelData = nullptr;
+}
+
+template <typename T>
+bool SubresourceStorage<T>::LayerRunsHaveSameData(const LayerRun& a, const LayerRun& b) const {
+    // Runs are recompressed after each update so runs with per-level data always have
+    // different data than compressed runs.
+    if ((a.perLevelData == nullptr) != (b.perLevelData == nullptr)) {
+        return false;
+    }
+    if (a.perLevelData == nullptr) {
+        return a.data == b.data;
+    }
+    for (uint32_t level = 0; level < mMipLevelCount; level++) {
+        if (!(a.perLevelData[level] == b.perLevelData[level])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template <typename T>
 bool& SubresourceStorage<T>::LayerCompressed(uint32_t aspectIndex, uint32_t layer) {
     DAWN_ASSERT(!mAspectCompressed[aspectIndex]);
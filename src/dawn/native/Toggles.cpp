@@ -542,6 +542,17 @@ static constexpr ToggleEnumAndInfoList kToggleNameAndInfoList = {{
       "Only use shader model 6.5 or less for D3D12 backend, to workaround issues on some Intel "
       "devices.",
       "https://crbug.com/dawn/2470", ToggleStage::Adapter}},
+    {Toggle::UsePackedCommandEncoding,
+     {"use_packed_command_encoding",
+      "Record draws and dispatches as varint-encoded deltas instead of fixed-size structs. This "
+      "makes command buffers and render bundles with many draws smaller, at the cost of decoding "
+      "them on each replay.",
+      "", ToggleStage::Device}},
+    {Toggle::ParallelSubmitValidation,
+     {"parallel_submit_validation",
+      "Validate the command buffers of a Queue::Submit in parallel on the worker task pool. This "
+      "is faster when submitting many large command buffers at once.",
+      "", ToggleStage::Device}},
     {Toggle::NoWorkaroundSampleMaskBecomesZeroForAllButLastColorTarget,
      {"no_workaround_sample_mask_becomes_zero_for_all_but_last_color_target",
       "MacOS 12.0+ Intel has a bug where the sample mask is only applied for the last color "
@@ -132,6 +132,8 @@ enum class Toggle {
     EnableImmediateErrorHandling,
     VulkanUseStorageInputOutput16,
     D3D12DontUseShaderModel66OrHigher,
+    UsePackedCommandEncoding,
+    ParallelSubmitValidation,
 
     // Unresolved issues.
     NoWorkaroundSampleMaskBecomesZeroForAllButLastColorTarget,
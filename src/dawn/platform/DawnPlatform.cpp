@@ -38,6 +38,13 @@ CachingInterface::CachingInterface() = default;
 
 CachingInterface::~CachingInterface() = default;
 
+std::unique_ptr<WaitableEvent> WorkerTaskPool::PostWorkerTaskWithPriority(
+    PostWorkerTaskCallback callback,
+    void* userdata,
+    TaskPriority priority) {
+    return PostWorkerTask(callback, userdata);
+}
+
 Platform::Platform() = default;
 
 Platform::~Platform() = default;
@@ -89,7 +96,11 @@ dawn::platform::CachingInterface* Platform::GetCachingInterface() {
 }
 
 std::unique_ptr<dawn::platform::WorkerTaskPool> Platform::CreateWorkerTaskPool() {
-    return std::make_unique<AsyncWorkerThreadPool>();
+    return std::make_unique<AsyncWorkerThreadPool>(GetMaxWorkerThreadCount());
+}
+
+uint32_t Platform::GetMaxWorkerThreadCount() {
+    return 0;
 }
 
 bool Platform::IsFeatureEnabled(Features feature) {
@@ -27,77 +27,239 @@
 
 #include "dawn/platform/WorkerThread.h"
 
-#include <condition_variable>
-#include <functional>
+#include <algorithm>
+#include <array>
+#include <deque>
 #include <thread>
+#include <utility>
 
 #include "dawn/common/Assert.h"
+#include "dawn/common/RefCounted.h"
+
+namespace dawn::platform {
 
 namespace {
 
-class AsyncWaitableEventImpl {
+constexpr size_t kPriorityCount = static_cast<size_t>(TaskPriority::High) + 1;
+
+// The pool and the index of the worker running on the current thread, so that tasks posted from
+// a worker go to its own queue.
+thread_local const AsyncWorkerThreadPool* tlPool = nullptr;
+thread_local uint32_t tlWorkerIndex = 0;
+
+}  // anonymous namespace
+
+// Shared by all the tasks of a pool. The mutex is only taken when a thread is actually blocked
+// on a task, which is rare since Wait() runs tasks that haven't started yet itself.
+struct CompletionSignal {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::atomic<uint32_t> waiterCount = 0;
+};
+
+class WorkerTask : public RefCounted {
   public:
-    AsyncWaitableEventImpl() : mIsComplete(false) {}
+    WorkerTask(PostWorkerTaskCallback callback,
+               void* userdata,
+               std::shared_ptr<CompletionSignal> signal)
+        : mCallback(callback), mUserdata(userdata), mSignal(std::move(signal)) {}
 
-    void Wait() {
-        std::unique_lock<std::mutex> lock(mMutex);
-        mCondition.wait(lock, [this] { return mIsComplete; });
-    }
+    // Runs the task unless it was already started by another thread. Returns false in that case.
+    bool TryRun() {
+        State expected = State::Queued;
+        if (!mState.compare_exchange_strong(expected, State::Running, std::memory_order_acquire)) {
+            return false;
+        }
+        mCallback(mUserdata);
 
-    bool IsComplete() {
-        std::lock_guard<std::mutex> lock(mMutex);
-        return mIsComplete;
+        // The sequentially consistent store and load pair with the ones in Wait(): either the
+        // waiter sees the task complete, or the task sees the waiter and notifies it.
+        mState.store(State::Complete, std::memory_order_seq_cst);
+        if (mSignal->waiterCount.load(std::memory_order_seq_cst) > 0) {
+            // Lock so that the notification can't fall between the check and the wait.
+            { std::lock_guard<std::mutex> lock(mSignal->mutex); }
+            mSignal->condition.notify_all();
+        }
+        return true;
     }
 
-    void MarkAsComplete() {
+    void Wait() {
+        if (TryRun()) {
+            return;
+        }
+        mSignal->waiterCount.fetch_add(1, std::memory_order_seq_cst);
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            mIsComplete = true;
+            std::unique_lock<std::mutex> lock(mSignal->mutex);
+            mSignal->condition.wait(lock, [this] { return IsComplete(); });
         }
-        mCondition.notify_all();
+        mSignal->waiterCount.fetch_sub(1, std::memory_order_relaxed);
     }
 
+    bool IsComplete() const { return mState.load(std::memory_order_acquire) == State::Complete; }
+
   private:
-    std::mutex mMutex;
-    std::condition_variable mCondition;
-    bool mIsComplete;
+    enum class State : uint8_t { Queued, Running, Complete };
+
+    PostWorkerTaskCallback mCallback;
+    void* mUserdata;
+    std::shared_ptr<CompletionSignal> mSignal;
+    std::atomic<State> mState = State::Queued;
 };
 
-class AsyncWaitableEvent final : public dawn::platform::WaitableEvent {
-  public:
-    AsyncWaitableEvent() : mWaitableEventImpl(std::make_shared<AsyncWaitableEventImpl>()) {}
+namespace {
 
-    void Wait() override { mWaitableEventImpl->Wait(); }
+class WorkerTaskEvent final : public WaitableEvent {
+  public:
+    explicit WorkerTaskEvent(Ref<WorkerTask> task) : mTask(std::move(task)) {}
 
-    bool IsComplete() override { return mWaitableEventImpl->IsComplete(); }
+    void Wait() override { mTask->Wait(); }
 
-    std::shared_ptr<AsyncWaitableEventImpl> GetWaitableEventImpl() const {
-        return mWaitableEventImpl;
-    }
+    bool IsComplete() override { return mTask->IsComplete(); }
 
   private:
-    std::shared_ptr<AsyncWaitableEventImpl> mWaitableEventImpl;
+    Ref<WorkerTask> mTask;
 };
 
 }  // anonymous namespace
 
-namespace dawn::platform {
+struct AsyncWorkerThreadPool::Worker {
+    std::thread thread;
+    // Protects the queues, which are only touched for the short time of a push or a pop.
+    std::mutex mutex;
+    std::array<std::deque<Ref<WorkerTask>>, kPriorityCount> queues;
+};
+
+AsyncWorkerThreadPool::AsyncWorkerThreadPool(uint32_t maxThreadCount)
+    : mMaxThreadCount(std::max(
+          1u,
+          maxThreadCount != 0 ? maxThreadCount : std::thread::hardware_concurrency())),
+      mCompletionSignal(std::make_shared<CompletionSignal>()) {
+    mWorkers.reserve(mMaxThreadCount);
+    for (uint32_t i = 0; i < mMaxThreadCount; ++i) {
+        mWorkers.push_back(std::make_unique<Worker>());
+    }
+}
+
+AsyncWorkerThreadPool::~AsyncWorkerThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mTaskPosted.notify_all();
+
+    // The workers only exit once all the queues are empty.
+    for (std::unique_ptr<Worker>& worker : mWorkers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+uint32_t AsyncWorkerThreadPool::GetMaxThreadCount() const {
+    return mMaxThreadCount;
+}
 
 std::unique_ptr<dawn::platform::WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
     dawn::platform::PostWorkerTaskCallback callback,
     void* userdata) {
-    std::unique_ptr<AsyncWaitableEvent> waitableEvent = std::make_unique<AsyncWaitableEvent>();
+    return PostWorkerTaskWithPriority(callback, userdata, TaskPriority::Normal);
+}
+
+std::unique_ptr<dawn::platform::WaitableEvent> AsyncWorkerThreadPool::PostWorkerTaskWithPriority(
+    dawn::platform::PostWorkerTaskCallback callback,
+    void* userdata,
+    dawn::platform::TaskPriority priority) {
+    Ref<WorkerTask> task = AcquireRef(new WorkerTask(callback, userdata, mCompletionSignal));
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        // Only tasks that are still running in the destructor may post more tasks.
+        DAWN_ASSERT(!mStopping || tlPool == this);
+
+        if (mIdleThreadCount == 0 && mStartedThreadCount < mMaxThreadCount) {
+            uint32_t index = mStartedThreadCount++;
+            mWorkers[index]->thread = std::thread([this, index] {
+                tlPool = this;
+                tlWorkerIndex = index;
+                WorkerLoop(mWorkers[index].get());
+            });
+        }
+
+        // Tasks posted by a worker stay on that worker, others are spread over the started
+        // workers and get stolen by whichever worker is idle.
+        uint32_t index;
+        if (tlPool == this) {
+            index = tlWorkerIndex;
+        } else {
+            index = mNextWorker++ % mStartedThreadCount;
+        }
+
+        Worker* worker = mWorkers[index].get();
+        {
+            std::lock_guard<std::mutex> queueLock(worker->mutex);
+            worker->queues[static_cast<size_t>(priority)].push_back(task);
+        }
+        mQueuedTaskCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    mTaskPosted.notify_one();
 
-    std::function<void()> doTask = [callback, userdata,
-                                    waitableEventImpl = waitableEvent->GetWaitableEventImpl()] {
-        callback(userdata);
-        waitableEventImpl->MarkAsComplete();
-    };
+    return std::make_unique<WorkerTaskEvent>(std::move(task));
+}
 
-    std::thread thread(doTask);
-    thread.detach();
+Ref<WorkerTask> AsyncWorkerThreadPool::PopTask(Worker* worker) {
+    for (size_t i = kPriorityCount; i-- > 0;) {
+        // Take the oldest task of our own queue first, then steal the newest task of another
+        // worker, which is the least likely to be cache-warm over there.
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            std::deque<Ref<WorkerTask>>& queue = worker->queues[i];
+            if (!queue.empty()) {
+                Ref<WorkerTask> task = std::move(queue.front());
+                queue.pop_front();
+                mQueuedTaskCount.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+        for (std::unique_ptr<Worker>& victim : mWorkers) {
+            if (victim.get() == worker) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(victim->mutex);
+            std::deque<Ref<WorkerTask>>& queue = victim->queues[i];
+            if (!queue.empty()) {
+                Ref<WorkerTask> task = std::move(queue.back());
+                queue.pop_back();
+                mQueuedTaskCount.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void AsyncWorkerThreadPool::WorkerLoop(Worker* worker) {
+    while (true) {
+        if (Ref<WorkerTask> task = PopTask(worker)) {
+            // The task may have been run by a thread waiting on it already.
+            task->TryRun();
+            continue;
+        }
 
-    return waitableEvent;
+        std::unique_lock<std::mutex> lock(mMutex);
+        if (mQueuedTaskCount.load(std::memory_order_relaxed) > 0) {
+            // A task was pushed after we looked at its queue, or another worker is about to
+            // decrement the count.
+            continue;
+        }
+        if (mStopping) {
+            return;
+        }
+        mIdleThreadCount++;
+        mTaskPosted.wait(lock, [this] {
+            return mStopping || mQueuedTaskCount.load(std::memory_order_relaxed) > 0;
+        });
+        mIdleThreadCount--;
+    }
 }
 
 }  // namespace dawn::platform
@@ -28,18 +28,72 @@
 #ifndef SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 #define SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "dawn/common/NonCopyable.h"
+#include "dawn/common/Ref.h"
 #include "dawn/platform/DawnPlatform.h"
 
 namespace dawn::platform {
 
+class WorkerTask;
+struct CompletionSignal;
+
+// A fixed-size pool of worker threads. Each worker owns one queue per TaskPriority and idle
+// workers steal from the queues of the other workers. Threads are only started when a task is
+// posted and no worker is idle, so pools that see little work stay cheap.
+//
+// Waiting on the event of a task that hasn't started yet runs the task on the waiting thread,
+// so tasks can wait on each other without exhausting the pool.
 class AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool, public NonCopyable {
   public:
+    // A |maxThreadCount| of zero uses one thread per hardware thread.
+    explicit AsyncWorkerThreadPool(uint32_t maxThreadCount = 0);
+    // Runs all the tasks that are still queued and joins the threads.
+    ~AsyncWorkerThreadPool() override;
+
     std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
         dawn::platform::PostWorkerTaskCallback callback,
         void* userdata) override;
+    std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTaskWithPriority(
+        dawn::platform::PostWorkerTaskCallback callback,
+        void* userdata,
+        dawn::platform::TaskPriority priority) override;
+
+    uint32_t GetMaxThreadCount() const;
+
+  private:
+    struct Worker;
+
+    void WorkerLoop(Worker* worker);
+    // Returns the highest priority task in the queue of |worker| or, failing that, steals one from
+    // another worker. Returns nullptr if all the queues are empty.
+    Ref<WorkerTask> PopTask(Worker* worker);
+
+    const uint32_t mMaxThreadCount;
+    // Created up-front so that stealing never races with the vector growing.
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+
+    // Protects the fields below and guards the sleep of idle workers.
+    std::mutex mMutex;
+    std::condition_variable mTaskPosted;
+    uint32_t mStartedThreadCount = 0;
+    uint32_t mIdleThreadCount = 0;
+    uint32_t mNextWorker = 0;
+    bool mStopping = false;
+    // The number of entries in all the queues. Incremented under mMutex after the entry is pushed
+    // and decremented under the queue's mutex when an entry is popped, so it can briefly be smaller
+    // than the actual number of entries (even negative) but never larger. Workers re-check it under
+    // mMutex before sleeping and the increment precedes the notification, so no entry is missed.
+    std::atomic<int64_t> mQueuedTaskCount = 0;
+
+    // Shared with the tasks, which can outlive the pool.
+    std::shared_ptr<CompletionSignal> mCompletionSignal;
 };
 
 }  // namespace dawn::platform
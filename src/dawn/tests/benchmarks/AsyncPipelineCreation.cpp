@@ -0,0 +1,166 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/tests/benchmarks/NullDeviceSetup.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+// The WorkerTaskPool that Dawn used before it had a bounded pool: one detached thread per task.
+// Kept here as a baseline for the throughput of the platform's pool.
+class ThreadPerTaskPool : public platform::WorkerTaskPool {
+  public:
+    std::unique_ptr<platform::WaitableEvent> PostWorkerTask(
+        platform::PostWorkerTaskCallback callback,
+        void* userdata) override {
+        auto event = std::make_unique<Event>();
+        std::thread([callback, userdata, state = event->state] {
+            callback(userdata);
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->complete = true;
+            state->condition.notify_all();
+        }).detach();
+        return event;
+    }
+
+  private:
+    struct State {
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool complete = false;
+    };
+
+    class Event : public platform::WaitableEvent {
+      public:
+        void Wait() override {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->condition.wait(lock, [this] { return state->complete; });
+        }
+        bool IsComplete() override {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            return state->complete;
+        }
+
+        std::shared_ptr<State> state = std::make_shared<State>();
+    };
+};
+
+// Benchmarks the throughput of compiling pipelines on a WorkerTaskPool, which is what
+// Create*PipelineAsync() does on the backends that support asynchronous compilation. The Null
+// backend compiles pipelines synchronously, so the tasks call CreateComputePipeline() directly.
+class AsyncPipelineCreation : public NullDeviceBenchmarkFixture {
+  protected:
+    AsyncPipelineCreation() {
+        // The pipelines are created concurrently from the worker threads.
+        requiredFeatures.push_back(wgpu::FeatureName::ImplicitDeviceSynchronization);
+    }
+
+    void Run(benchmark::State& state, platform::WorkerTaskPool* pool) {
+        struct Task {
+            wgpu::Device device;
+            wgpu::ComputePipelineDescriptor desc;
+            wgpu::ConstantEntry constant;
+            wgpu::ComputePipeline pipeline;
+        };
+
+        wgpu::ShaderModule module = utils::CreateShaderModule(device, R"(
+            override x: u32 = 0u;
+            @compute @workgroup_size(1) fn main() { _ = x; }
+        )");
+        wgpu::PipelineLayout layout = utils::MakePipelineLayout(device, {});
+
+        const size_t taskCount = static_cast<size_t>(state.range(0));
+        std::vector<Task> tasks(taskCount);
+        std::vector<std::unique_ptr<platform::WaitableEvent>> events(taskCount);
+        uint32_t nextConstant = 0;
+        for (auto _ : state) {
+            // Each pipeline is unique so that none of them hit the cache.
+            for (Task& task : tasks) {
+                task.device = device;
+                task.constant.key = "x";
+                task.constant.value = nextConstant++;
+                task.desc.compute.module = module;
+                task.desc.compute.constantCount = 1;
+                task.desc.compute.constants = &task.constant;
+                task.desc.layout = layout;
+            }
+            for (size_t i = 0; i < taskCount; ++i) {
+                events[i] = pool->PostWorkerTask(
+                    [](void* userdata) {
+                        Task* task = static_cast<Task*>(userdata);
+                        task->pipeline = task->device.CreateComputePipeline(&task->desc);
+                    },
+                    &tasks[i]);
+            }
+            for (std::unique_ptr<platform::WaitableEvent>& event : events) {
+                event->Wait();
+            }
+            for (Task& task : tasks) {
+                task.pipeline = nullptr;
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * taskCount));
+    }
+
+  private:
+    wgpu::DeviceDescriptor GetDeviceDescriptor() const override {
+        wgpu::DeviceDescriptor deviceDesc = {};
+        deviceDesc.requiredFeatures = requiredFeatures.data();
+        deviceDesc.requiredFeatureCount = requiredFeatures.size();
+        return deviceDesc;
+    }
+
+    std::vector<wgpu::FeatureName> requiredFeatures;
+};
+
+BENCHMARK_DEFINE_F(AsyncPipelineCreation, PlatformPool)
+(benchmark::State& state) {
+    platform::Platform platform;
+    std::unique_ptr<platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+    Run(state, pool.get());
+}
+BENCHMARK_REGISTER_F(AsyncPipelineCreation, PlatformPool)->Arg(16)->Arg(256);
+
+BENCHMARK_DEFINE_F(AsyncPipelineCreation, ThreadPerTask)
+(benchmark::State& state) {
+    ThreadPerTaskPool pool;
+    Run(state, &pool);
+}
+BENCHMARK_REGISTER_F(AsyncPipelineCreation, ThreadPerTask)->Arg(16)->Arg(256);
+
+}  // namespace
+}  // namespace dawn
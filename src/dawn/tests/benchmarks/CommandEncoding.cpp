@@ -0,0 +1,101 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <utility>
+
+#include "dawn/native/CommandAllocator.h"
+#include "dawn/native/Commands.h"
+
+namespace dawn::native {
+namespace {
+
+// Benchmarks recording and replaying draws in the regular and the packed command formats. The
+// draws look like those of a scene with many small meshes sharing vertex and index buffers.
+DrawIndexedCmd GetDraw(int64_t i) {
+    DrawIndexedCmd draw;
+    draw.indexCount = 36 + 6 * static_cast<uint32_t>(i % 4);
+    draw.instanceCount = 1;
+    draw.firstIndex = 36 * static_cast<uint32_t>(i);
+    draw.baseVertex = 24 * static_cast<int32_t>(i % 512);
+    draw.firstInstance = 0;
+    return draw;
+}
+
+template <bool kPacked>
+void Record(CommandAllocator* allocator, int64_t drawCount) {
+    for (int64_t i = 0; i < drawCount; ++i) {
+        if constexpr (kPacked) {
+            allocator->AllocatePacked(Command::DrawIndexed, GetDraw(i));
+        } else {
+            *allocator->Allocate<DrawIndexedCmd>(Command::DrawIndexed) = GetDraw(i);
+        }
+    }
+}
+
+template <bool kPacked>
+void RecordDraws(benchmark::State& state) {
+    size_t allocatedSize = 0;
+    for (auto _ : state) {
+        CommandAllocator allocator;
+        Record<kPacked>(&allocator, state.range(0));
+        allocatedSize = allocator.GetAllocatedSizeForTesting();
+        benchmark::DoNotOptimize(allocator);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["bytes"] = static_cast<double>(allocatedSize);
+}
+
+template <bool kPacked>
+void ReplayDraws(benchmark::State& state) {
+    CommandAllocator allocator;
+    Record<kPacked>(&allocator, state.range(0));
+    size_t allocatedSize = allocator.GetAllocatedSizeForTesting();
+    CommandIterator iterator(std::move(allocator));
+
+    for (auto _ : state) {
+        uint32_t indexCount = 0;
+        Command type;
+        while (iterator.NextCommandId(&type)) {
+            indexCount += iterator.NextCommand<DrawIndexedCmd>()->indexCount;
+        }
+        iterator.Reset();
+        benchmark::DoNotOptimize(indexCount);
+    }
+    iterator.MakeEmptyAsDataWasDestroyed();
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["bytes"] = static_cast<double>(allocatedSize);
+}
+
+BENCHMARK(RecordDraws<false>)->Arg(16)->Arg(1024)->Arg(65536);
+BENCHMARK(RecordDraws<true>)->Arg(16)->Arg(1024)->Arg(65536);
+BENCHMARK(ReplayDraws<false>)->Arg(16)->Arg(1024)->Arg(65536);
+BENCHMARK(ReplayDraws<true>)->Arg(16)->Arg(1024)->Arg(65536);
+
+}  // namespace
+}  // namespace dawn::native
@@ -249,5 +249,34 @@ BENCHMARK_DEFINE_F(ObjectCreation, UniqueRenderPipeline)
 }
 BENCHMARK_REGISTER_F(ObjectCreation, UniqueRenderPipeline)->Threads(1)->Threads(4)->Threads(16);
 
+// Records and drops many small command buffers, which recycles their command blocks.
+BENCHMARK_DEFINE_F(ObjectCreation, EncoderChurn)
+(benchmark::State& state) {
+    wgpu::ComputePipelineDescriptor computeDesc = {};
+    computeDesc.compute.module = utils::CreateShaderModule(device, R"(
+        @compute @workgroup_size(1) fn main() {}
+    )");
+    computeDesc.layout = utils::MakePipelineLayout(device, {});
+    wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&computeDesc);
+
+    for (auto _ : state) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+        pass.SetPipeline(pipeline);
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            pass.DispatchWorkgroups(1);
+        }
+        pass.End();
+        wgpu::CommandBuffer commands = encoder.Finish();
+        benchmark::DoNotOptimize(commands);
+    }
+}
+BENCHMARK_REGISTER_F(ObjectCreation, EncoderChurn)
+    ->Arg(1)
+    ->Arg(256)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16);
+
 }  // namespace
 }  // namespace dawn
@@ -0,0 +1,138 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+#include <vector>
+
+#include "dawn/tests/benchmarks/NullDeviceSetup.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+constexpr uint32_t kBindGroupCount = 16;
+constexpr uint32_t kPassesPerCommandBuffer = 64;
+
+// Benchmarks Queue::Submit() of several command buffers that each reference many buffers, with
+// the validation of the command buffers done serially or in parallel on the worker task pool.
+// Encoding the command buffers is not timed.
+class QueueSubmit : public NullDeviceBenchmarkFixture {
+  protected:
+    explicit QueueSubmit(bool parallelSubmitValidation) {
+        if (parallelSubmitValidation) {
+            deviceToggles.enabledToggleCount = 1;
+            deviceToggles.enabledToggles = &kParallelSubmitValidationToggle;
+        }
+    }
+
+    void Run(benchmark::State& state) {
+        wgpu::ComputePipelineDescriptor pipelineDesc;
+        pipelineDesc.compute.module = utils::CreateShaderModule(device, R"(
+            @group(0) @binding(0) var<storage, read_write> b0 : u32;
+            @group(0) @binding(1) var<storage, read_write> b1 : u32;
+            @group(0) @binding(2) var<storage, read_write> b2 : u32;
+            @group(0) @binding(3) var<storage, read_write> b3 : u32;
+            @compute @workgroup_size(1) fn main() {
+                b0 = b1 + b2 + b3;
+            }
+        )");
+        wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&pipelineDesc);
+
+        wgpu::BufferDescriptor bufferDesc;
+        bufferDesc.size = sizeof(uint32_t);
+        bufferDesc.usage = wgpu::BufferUsage::Storage;
+        std::vector<wgpu::BindGroup> bindGroups;
+        for (uint32_t i = 0; i < kBindGroupCount; ++i) {
+            bindGroups.push_back(utils::MakeBindGroup(device, pipeline.GetBindGroupLayout(0),
+                                                      {
+                                                          {0, device.CreateBuffer(&bufferDesc)},
+                                                          {1, device.CreateBuffer(&bufferDesc)},
+                                                          {2, device.CreateBuffer(&bufferDesc)},
+                                                          {3, device.CreateBuffer(&bufferDesc)},
+                                                      }));
+        }
+
+        wgpu::Queue queue = device.GetQueue();
+        const size_t commandBufferCount = static_cast<size_t>(state.range(0));
+        std::vector<wgpu::CommandBuffer> commandBuffers(commandBufferCount);
+        for (auto _ : state) {
+            state.PauseTiming();
+            for (wgpu::CommandBuffer& commandBuffer : commandBuffers) {
+                wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+                for (uint32_t i = 0; i < kPassesPerCommandBuffer; ++i) {
+                    wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+                    pass.SetPipeline(pipeline);
+                    pass.SetBindGroup(0, bindGroups[i % kBindGroupCount]);
+                    pass.DispatchWorkgroups(1);
+                    pass.End();
+                }
+                commandBuffer = encoder.Finish();
+            }
+            device.Tick();
+            state.ResumeTiming();
+
+            queue.Submit(commandBuffers.size(), commandBuffers.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * commandBufferCount));
+    }
+
+  private:
+    wgpu::DeviceDescriptor GetDeviceDescriptor() const override {
+        wgpu::DeviceDescriptor deviceDesc = {};
+        deviceDesc.nextInChain = &deviceToggles;
+        return deviceDesc;
+    }
+
+    static constexpr const char* kParallelSubmitValidationToggle = "parallel_submit_validation";
+    wgpu::DawnTogglesDescriptor deviceToggles;
+};
+
+class SerialSubmitValidation : public QueueSubmit {
+  protected:
+    SerialSubmitValidation() : QueueSubmit(false) {}
+};
+
+class ParallelSubmitValidation : public QueueSubmit {
+  protected:
+    ParallelSubmitValidation() : QueueSubmit(true) {}
+};
+
+BENCHMARK_DEFINE_F(SerialSubmitValidation, Submit)
+(benchmark::State& state) {
+    Run(state);
+}
+BENCHMARK_REGISTER_F(SerialSubmitValidation, Submit)->Arg(8)->Arg(16);
+
+BENCHMARK_DEFINE_F(ParallelSubmitValidation, Submit)
+(benchmark::State& state) {
+    Run(state);
+}
+BENCHMARK_REGISTER_F(ParallelSubmitValidation, Submit)->Arg(8)->Arg(16);
+
+}  // namespace
+}  // namespace dawn
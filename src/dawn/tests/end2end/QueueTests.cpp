@@ -54,6 +54,42 @@ DAWN_INSTANTIATE_TEST(QueueTests,
                       OpenGLESBackend(),
                       VulkanBackend());
 
+class QueueSubmitTests : public DawnTest {};
+
+// Test that the command buffers of a submit execute in order. Each of them copies the value written
+// by the previous one, so the last buffer only gets the value if they all ran in order.
+TEST_P(QueueSubmitTests, ManyCommandBuffersExecuteInOrder) {
+    constexpr uint32_t kCommandBufferCount = 16;
+    constexpr uint32_t kValue = 0x1234;
+
+    std::vector<wgpu::Buffer> buffers;
+    for (uint32_t i = 0; i <= kCommandBufferCount; ++i) {
+        buffers.push_back(utils::CreateBufferFromData(
+            device, wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst, {i == 0 ? kValue : 0}));
+    }
+
+    std::vector<wgpu::CommandBuffer> commands;
+    for (uint32_t i = 0; i < kCommandBufferCount; ++i) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        encoder.CopyBufferToBuffer(buffers[i], 0, buffers[i + 1], 0, sizeof(uint32_t));
+        commands.push_back(encoder.Finish());
+    }
+    queue.Submit(commands.size(), commands.data());
+
+    EXPECT_BUFFER_U32_EQ(kValue, buffers.back(), 0);
+}
+
+DAWN_INSTANTIATE_TEST(QueueSubmitTests,
+                      D3D11Backend(),
+                      D3D12Backend(),
+                      D3D12Backend({"parallel_submit_validation"}),
+                      MetalBackend(),
+                      MetalBackend({"parallel_submit_validation"}),
+                      OpenGLBackend(),
+                      OpenGLESBackend(),
+                      VulkanBackend(),
+                      VulkanBackend({"parallel_submit_validation"}));
+
 class QueueWriteBufferTests : public DawnTest {};
 
 // Test the simplest WriteBuffer setting one u32 at offset 0.
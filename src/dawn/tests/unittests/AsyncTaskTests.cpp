@@ -29,6 +29,7 @@
 // AsyncTaskTests:
 //     Simple tests for native::AsyncTask and native::AsnycTaskManager.
 
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -103,5 +104,63 @@ TEST_F(AsyncTaskTest, Basic) {
     ASSERT_TRUE(idset.empty());
 }
 
+class OneWorkerPlatform : public platform::Platform {
+  public:
+    uint32_t GetMaxWorkerThreadCount() override { return 1; }
+};
+
+// Check that the tasks posted with a higher priority run first, as the ones posted by
+// Create*PipelineAsync() after SetAsyncPipelineCreationPriority() do.
+TEST_F(AsyncTaskTest, HigherPriorityRunsFirst) {
+    OneWorkerPlatform platform;
+    std::unique_ptr<platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+    native::AsyncTaskManager taskManager(pool.get());
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool blockerStarted = false;
+    bool blockerReleased = false;
+    std::vector<platform::TaskPriority> order;
+
+    // Keep the only worker busy while the other tasks are queued.
+    taskManager.PostTask([&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        blockerStarted = true;
+        condition.notify_all();
+        condition.wait(lock, [&] { return blockerReleased; });
+    });
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&] { return blockerStarted; });
+    }
+
+    for (platform::TaskPriority priority :
+         {platform::TaskPriority::Low, platform::TaskPriority::Normal,
+          platform::TaskPriority::High}) {
+        taskManager.PostTask(
+            [&, priority] {
+                std::lock_guard<std::mutex> lock(mutex);
+                order.push_back(priority);
+                condition.notify_all();
+            },
+            priority);
+    }
+
+    // Wait for the worker to run the tasks before WaitAllPendingTasks(), which may run the tasks
+    // on this thread in posting order.
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        blockerReleased = true;
+        condition.notify_all();
+        condition.wait(lock, [&] { return order.size() == 3u; });
+    }
+    taskManager.WaitAllPendingTasks();
+
+    std::vector<platform::TaskPriority> expected = {platform::TaskPriority::High,
+                                                    platform::TaskPriority::Normal,
+                                                    platform::TaskPriority::Low};
+    EXPECT_EQ(expected, order);
+}
+
 }  // anonymous namespace
 }  // namespace dawn
@@ -68,6 +68,21 @@ struct CommandSmall {
     uint16_t data;
 };
 
+template <>
+struct PackedCommandTraits<CommandDraw> {
+    static constexpr bool kIsPacked = true;
+    static constexpr size_t kFieldCount = 2;
+    static constexpr size_t kStateOffset = 0;
+    static void ToFields(const CommandDraw& cmd, uint32_t* fields) {
+        fields[0] = cmd.first;
+        fields[1] = cmd.count;
+    }
+    static void FromFields(const uint32_t* fields, CommandDraw* cmd) {
+        cmd->first = fields[0];
+        cmd->count = fields[1];
+    }
+};
+
 // Test allocating nothing works
 TEST(CommandAllocator, DoNothingAllocator) {
     CommandAllocator allocator;
@@ -513,4 +528,233 @@ TEST(CommandAllocator, AcquireCommandBlocks) {
     iterator.MakeEmptyAsDataWasDestroyed();
 }
 
+// Records one draw command in |allocator|.
+void RecordDraw(CommandAllocator* allocator, uint32_t first) {
+    CommandDraw* draw = allocator->Allocate<CommandDraw>(CommandType::Draw);
+    draw->first = first;
+    draw->count = 1;
+}
+
+// Test that blocks freed by an iterator are reused by the next allocator using the same pool.
+TEST(CommandAllocator, BlockPoolRecyclesBlocks) {
+    CommandBlockPool pool;
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        CommandAllocator allocator(&pool);
+        RecordDraw(&allocator, i);
+
+        CommandIterator iterator(std::move(allocator));
+        CommandType type;
+        ASSERT_TRUE(iterator.NextCommandId(&type));
+        ASSERT_EQ(type, CommandType::Draw);
+        ASSERT_EQ(iterator.NextCommand<CommandDraw>()->first, i);
+        ASSERT_FALSE(iterator.NextCommandId(&type));
+        iterator.MakeEmptyAsDataWasDestroyed();
+
+        EXPECT_EQ(1u, pool.GetCachedBlockCount());
+    }
+    EXPECT_EQ(1u, pool.GetMissCount());
+    EXPECT_EQ(2u, pool.GetHitCount());
+}
+
+// Test that resetting an allocator and moving from it keep using the pool.
+TEST(CommandAllocator, BlockPoolResetAndMove) {
+    CommandBlockPool pool;
+
+    CommandAllocator allocator(&pool);
+    RecordDraw(&allocator, 0);
+    allocator.Reset();
+    EXPECT_EQ(1u, pool.GetCachedBlockCount());
+
+    RecordDraw(&allocator, 1);
+    EXPECT_EQ(0u, pool.GetCachedBlockCount());
+    CommandAllocator moved = std::move(allocator);
+
+    // The moved-from allocator takes its next block from the pool too.
+    RecordDraw(&allocator, 2);
+    EXPECT_EQ(1u, pool.GetHitCount());
+    EXPECT_EQ(2u, pool.GetMissCount());
+
+    allocator.Reset();
+    moved.Reset();
+    EXPECT_EQ(2u, pool.GetCachedBlockCount());
+}
+
+// Test that many small commands that need blocks of several size classes round-trip through the
+// pool.
+TEST(CommandAllocator, BlockPoolManySmallCommands) {
+    CommandBlockPool pool;
+
+    for (uint32_t iteration = 0; iteration < 2; ++iteration) {
+        CommandAllocator allocator(&pool);
+        const int kCommandCount = 50000;
+        uint16_t count = 0;
+        for (int i = 0; i < kCommandCount; i++) {
+            CommandSmall* small = allocator.Allocate<CommandSmall>(CommandType::Small);
+            small->data = count++;
+        }
+
+        CommandIterator iterator(std::move(allocator));
+        CommandType type;
+        count = 0;
+        while (iterator.NextCommandId(&type)) {
+            ASSERT_EQ(type, CommandType::Small);
+            ASSERT_EQ(iterator.NextCommand<CommandSmall>()->data, count);
+            count++;
+        }
+        ASSERT_EQ(count, kCommandCount);
+        iterator.MakeEmptyAsDataWasDestroyed();
+    }
+
+    // The second iteration needs exactly the blocks of the first one.
+    EXPECT_EQ(pool.GetMissCount(), pool.GetHitCount());
+    EXPECT_EQ(pool.GetMissCount(), pool.GetCachedBlockCount());
+}
+
+// Test that blocks larger than the biggest size class aren't cached.
+TEST(CommandAllocator, BlockPoolLargeCommandsNotCached) {
+    CommandBlockPool pool;
+
+    CommandAllocator allocator(&pool);
+    allocator.Allocate<CommandBig>(CommandType::Big);
+    CommandIterator iterator(std::move(allocator));
+    iterator.MakeEmptyAsDataWasDestroyed();
+
+    EXPECT_EQ(0u, pool.GetCachedBlockCount());
+    EXPECT_EQ(1u, pool.GetMissCount());
+}
+
+// Test that Trim() keeps the blocks needed since the previous Trim() and frees the others.
+TEST(CommandAllocator, BlockPoolTrimToHighWaterMark) {
+    CommandBlockPool pool;
+
+    // Use three blocks at once, then one.
+    {
+        std::vector<CommandAllocator> allocators;
+        for (uint32_t i = 0; i < 3; ++i) {
+            allocators.emplace_back(&pool);
+            RecordDraw(&allocators.back(), i);
+        }
+    }
+    {
+        CommandAllocator allocator(&pool);
+        RecordDraw(&allocator, 0);
+    }
+    EXPECT_EQ(3u, pool.GetCachedBlockCount());
+
+    // Three blocks were in use at once, so they all stay cached.
+    pool.Trim();
+    EXPECT_EQ(3u, pool.GetCachedBlockCount());
+
+    // Only one block was needed since the last trim.
+    {
+        CommandAllocator allocator(&pool);
+        RecordDraw(&allocator, 0);
+    }
+    pool.Trim();
+    EXPECT_EQ(1u, pool.GetCachedBlockCount());
+
+    // Blocks in use are never freed and nothing is cached after an idle period.
+    CommandAllocator allocator(&pool);
+    RecordDraw(&allocator, 0);
+    pool.Trim();
+    EXPECT_EQ(0u, pool.GetCachedBlockCount());
+    allocator.Reset();
+    EXPECT_EQ(1u, pool.GetCachedBlockCount());
+    pool.Trim();
+    pool.Trim();
+    EXPECT_EQ(0u, pool.GetCachedBlockCount());
+}
+
+// Test that packed commands decode correctly when interleaved with regular commands and data.
+TEST(CommandAllocator, PackedCommandsMixedWithRegularCommands) {
+    CommandAllocator allocator;
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        CommandPipeline* pipeline = allocator.Allocate<CommandPipeline>(CommandType::Pipeline);
+        pipeline->pipeline = 0xDEADBEEFBEEFDEADull + i;
+        pipeline->attachmentPoint = i;
+
+        CommandPushConstants* pushConstants =
+            allocator.Allocate<CommandPushConstants>(CommandType::PushConstants);
+        pushConstants->size = 4;
+        pushConstants->offset = 0;
+        *allocator.AllocateData<uint32_t>(1) = i * 7;
+
+        ASSERT_TRUE(allocator.AllocatePacked(CommandType::Draw, CommandDraw{i * 3, 100 + i}));
+    }
+
+    CommandIterator iterator(std::move(allocator));
+    CommandType type;
+    for (uint32_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(iterator.NextCommandId(&type));
+        ASSERT_EQ(type, CommandType::Pipeline);
+        CommandPipeline* pipeline = iterator.NextCommand<CommandPipeline>();
+        ASSERT_EQ(pipeline->pipeline, 0xDEADBEEFBEEFDEADull + i);
+        ASSERT_EQ(pipeline->attachmentPoint, i);
+
+        ASSERT_TRUE(iterator.NextCommandId(&type));
+        ASSERT_EQ(type, CommandType::PushConstants);
+        CommandPushConstants* pushConstants = iterator.NextCommand<CommandPushConstants>();
+        ASSERT_EQ(pushConstants->size, 4u);
+        ASSERT_EQ(*iterator.NextData<uint32_t>(1), i * 7);
+
+        ASSERT_TRUE(iterator.NextCommandId(&type));
+        ASSERT_EQ(type, CommandType::Draw);
+        CommandDraw* draw = iterator.NextCommand<CommandDraw>();
+        ASSERT_EQ(draw->first, i * 3);
+        ASSERT_EQ(draw->count, 100 + i);
+    }
+    ASSERT_FALSE(iterator.NextCommandId(&type));
+    iterator.MakeEmptyAsDataWasDestroyed();
+}
+
+// Test that packed commands with large and decreasing values, spanning several blocks, round-trip
+// and can be iterated again after a Reset.
+TEST(CommandAllocator, PackedCommandsAcrossBlocks) {
+    CommandAllocator allocator;
+
+    const uint32_t kCommandCount = 20000;
+    auto GetDraw = [](uint32_t i) {
+        return CommandDraw{i * 0x9E3779B9u, (i % 3 == 0) ? std::numeric_limits<uint32_t>::max()
+                                                         : kCommandCount - i};
+    };
+    for (uint32_t i = 0; i < kCommandCount; ++i) {
+        ASSERT_TRUE(allocator.AllocatePacked(CommandType::Draw, GetDraw(i)));
+    }
+
+    CommandIterator iterator(std::move(allocator));
+    for (int pass = 0; pass < 2; ++pass) {
+        CommandType type;
+        uint32_t count = 0;
+        while (iterator.NextCommandId(&type)) {
+            ASSERT_EQ(type, CommandType::Draw);
+            CommandDraw* draw = iterator.NextCommand<CommandDraw>();
+            CommandDraw expected = GetDraw(count);
+            ASSERT_EQ(draw->first, expected.first);
+            ASSERT_EQ(draw->count, expected.count);
+            count++;
+        }
+        ASSERT_EQ(count, kCommandCount);
+        iterator.Reset();
+    }
+    iterator.MakeEmptyAsDataWasDestroyed();
+}
+
+// Test that packed commands with slowly changing values take less memory than regular ones.
+TEST(CommandAllocator, PackedCommandsAreSmaller) {
+    const uint32_t kCommandCount = 10000;
+
+    CommandAllocator regular;
+    CommandAllocator packed;
+    for (uint32_t i = 0; i < kCommandCount; ++i) {
+        CommandDraw* draw = regular.Allocate<CommandDraw>(CommandType::Draw);
+        draw->first = i * 6;
+        draw->count = 6;
+        ASSERT_TRUE(packed.AllocatePacked(CommandType::Draw, CommandDraw{i * 6, 6}));
+    }
+
+    EXPECT_LT(packed.GetAllocatedSizeForTesting(), regular.GetAllocatedSizeForTesting());
+}
+
 }  // namespace dawn::native
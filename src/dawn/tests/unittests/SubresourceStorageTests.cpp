@@ -27,6 +27,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -751,6 +752,126 @@ TEST(SubresourceStorageTest, FillAfterModificationRecompresses) {
     CheckAspectCompressed(s, Aspect::Stencil, true);
 }
 
+// Returns the number of ranges that Iterate() calls its function with.
+template <typename T>
+uint32_t GetIterateRangeCount(const SubresourceStorage<T>& s) {
+    uint32_t count = 0;
+    s.Iterate([&](const SubresourceRange&, const T&) { count++; });
+    return count;
+}
+
+// Test that the LayerRanges mode is used by default for storages with many array layers.
+TEST(SubresourceStorageTest, LayerRangesDefaultMode) {
+    SubresourceStorage<int> small(Aspect::Color, kMinArrayLayerCountForLayerRanges - 1, 3);
+    EXPECT_EQ(small.GetModeForTesting(), SubresourceStorageMode::PerLayer);
+
+    SubresourceStorage<int> large(Aspect::Color, kMinArrayLayerCountForLayerRanges, 3);
+    EXPECT_EQ(large.GetModeForTesting(), SubresourceStorageMode::LayerRanges);
+}
+
+// Test that updating the mip chain of a single layer in a huge array only creates ranges for the
+// layers before and after it, and that updating the whole layer again recompresses the aspect.
+TEST(SubresourceStorageTest, LayerRangesSingleLayerMipChain) {
+    const uint32_t kLayers = 2048;
+    const uint32_t kLevels = 12;
+    const uint32_t kUpdatedLayer = 1000;
+    SubresourceStorage<int> s(SubresourceStorageMode::LayerRanges, Aspect::Color, kLayers, kLevels);
+    FakeStorage<int> f(Aspect::Color, kLayers, kLevels);
+
+    for (uint32_t level = 0; level < kLevels; level++) {
+        SubresourceRange range = SubresourceRange::MakeSingle(Aspect::Color, kUpdatedLayer, level);
+        CallUpdateOnBoth(&s, &f, range,
+                         [&](const SubresourceRange&, int* data) { *data = level + 1; });
+    }
+
+    // The layers before and after the updated one are one range each.
+    EXPECT_EQ(GetIterateRangeCount(s), 2 + kLevels);
+    CheckAspectCompressed(s, Aspect::Color, false);
+    CheckLayerCompressed(s, Aspect::Color, kUpdatedLayer, false);
+    EXPECT_TRUE(s.IsLayerCompressedForTesting(Aspect::Color, kUpdatedLayer - 1));
+    EXPECT_TRUE(s.IsLayerCompressedForTesting(Aspect::Color, kUpdatedLayer + 1));
+
+    // Setting the layer back to the value of the other layers merges all the ranges.
+    {
+        SubresourceRange range(Aspect::Color, {kUpdatedLayer, 1}, {0, kLevels});
+        CallUpdateOnBoth(&s, &f, range, [](const SubresourceRange&, int* data) { *data = 0; });
+    }
+    CheckAspectCompressed(s, Aspect::Color, true);
+}
+
+// Test that bands of layers that end up with the same data are merged in a single range.
+TEST(SubresourceStorageTest, LayerRangesAdjacentBandsCoalesce) {
+    const uint32_t kLayers = 100;
+    const uint32_t kLevels = 4;
+    SubresourceStorage<int> s(SubresourceStorageMode::LayerRanges, Aspect::Depth | Aspect::Stencil,
+                              kLayers, kLevels);
+    FakeStorage<int> f(Aspect::Depth | Aspect::Stencil, kLayers, kLevels);
+
+    // Three bands of depth layers, the middle one with a different value for level 2.
+    CallUpdateOnBoth(&s, &f, {Aspect::Depth, {10, 10}, {0, kLevels}},
+                     [](const SubresourceRange&, int* data) { *data = 1; });
+    CallUpdateOnBoth(&s, &f, {Aspect::Depth, {30, 10}, {0, kLevels}},
+                     [](const SubresourceRange&, int* data) { *data = 1; });
+    CallUpdateOnBoth(&s, &f, {Aspect::Depth, {20, 10}, {2, 1}},
+                     [](const SubresourceRange&, int* data) { *data = 1; });
+    CheckAspectCompressed(s, Aspect::Stencil, true);
+    // Stencil, then depth layers 0-9, 10-19, 30-39 and 40-99 and each level of 20-29.
+    EXPECT_EQ(GetIterateRangeCount(s), 1u + 4u + kLevels);
+
+    // Filling the gap merges the three bands.
+    CallUpdateOnBoth(&s, &f, {Aspect::Depth, {20, 10}, {0, kLevels}},
+                     [](const SubresourceRange&, int* data) { *data = 1; });
+    EXPECT_EQ(GetIterateRangeCount(s), 1u + 3u);
+    EXPECT_TRUE(s.IsLayerCompressedForTesting(Aspect::Depth, 25));
+}
+
+// Test merging storages in all combinations of modes, with random content.
+TEST(SubresourceStorageTest, LayerRangesRandomUpdatesAndMerges) {
+    const uint32_t kLayers = 70;
+    const uint32_t kLevels = 5;
+    const Aspect kAspects = Aspect::Depth | Aspect::Stencil;
+    std::mt19937 rng(1234);
+
+    auto RandomRange = [&]() {
+        Aspect aspects = std::uniform_int_distribution<int>(0, 2)(rng) == 0 ? Aspect::Depth
+                         : std::uniform_int_distribution<int>(0, 1)(rng) == 0 ? Aspect::Stencil
+                                                                              : kAspects;
+        uint32_t baseLayer = std::uniform_int_distribution<uint32_t>(0, kLayers - 1)(rng);
+        uint32_t layerCount =
+            std::uniform_int_distribution<uint32_t>(1, std::min(kLayers - baseLayer, 20u))(rng);
+        uint32_t baseLevel = std::uniform_int_distribution<uint32_t>(0, kLevels - 1)(rng);
+        uint32_t levelCount =
+            std::uniform_int_distribution<uint32_t>(1, kLevels - baseLevel)(rng);
+        return SubresourceRange(aspects, {baseLayer, layerCount}, {baseLevel, levelCount});
+    };
+
+    for (SubresourceStorageMode mode :
+         {SubresourceStorageMode::PerLayer, SubresourceStorageMode::LayerRanges}) {
+        for (SubresourceStorageMode otherMode :
+             {SubresourceStorageMode::PerLayer, SubresourceStorageMode::LayerRanges}) {
+            SubresourceStorage<int> s(mode, kAspects, kLayers, kLevels);
+            FakeStorage<int> f(kAspects, kLayers, kLevels);
+
+            for (uint32_t i = 0; i < 20; i++) {
+                SubresourceStorage<int> other(otherMode, kAspects, kLayers, kLevels);
+                for (uint32_t j = 0; j < 4; j++) {
+                    int value = std::uniform_int_distribution<int>(0, 2)(rng);
+                    other.Update(RandomRange(),
+                                 [&](const SubresourceRange&, int* data) { *data = value; });
+                }
+
+                // Use a small set of values so that ranges get recompressed sometimes.
+                int value = std::uniform_int_distribution<int>(0, 2)(rng);
+                CallUpdateOnBoth(&s, &f, RandomRange(),
+                                 [&](const SubresourceRange&, int* data) { *data = value; });
+                CallMergeOnBoth(&s, &f, other, [](const SubresourceRange&, int* data, int other) {
+                    *data = (*data + other) % 3;
+                });
+            }
+        }
+    }
+}
+
 // Bugs found while testing:
 //  - mLayersCompressed not initialized to true.
 //  - DecompressLayer setting Compressed to true instead of false.
@@ -0,0 +1,238 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <chrono>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dawn/platform/DawnPlatform.h"
+#include "gtest/gtest.h"
+
+namespace dawn {
+namespace {
+
+class BoundedPlatform : public platform::Platform {
+  public:
+    explicit BoundedPlatform(uint32_t maxThreadCount) : mMaxThreadCount(maxThreadCount) {}
+
+    uint32_t GetMaxWorkerThreadCount() override { return mMaxThreadCount; }
+
+  private:
+    uint32_t mMaxThreadCount;
+};
+
+// A task that blocks its worker until Release() is called.
+class BlockingTask {
+  public:
+    static void Run(void* userdata) {
+        BlockingTask* self = static_cast<BlockingTask*>(userdata);
+        std::unique_lock<std::mutex> lock(self->mMutex);
+        self->mStarted = true;
+        self->mCondition.notify_all();
+        self->mCondition.wait(lock, [self] { return self->mReleased; });
+    }
+
+    void WaitUntilStarted() {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return mStarted; });
+    }
+
+    void Release() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mReleased = true;
+        mCondition.notify_all();
+    }
+
+  private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mStarted = false;
+    bool mReleased = false;
+};
+
+void IncrementCounter(void* userdata) {
+    static_cast<std::atomic<uint32_t>*>(userdata)->fetch_add(1);
+}
+
+// Spins until |event| completes without running its task on this thread.
+void WaitWithoutRunning(platform::WaitableEvent* event) {
+    while (!event->IsComplete()) {
+        std::this_thread::yield();
+    }
+}
+
+// Test that all the posted tasks run and complete.
+TEST(WorkerTaskPoolTests, AllTasksComplete) {
+    BoundedPlatform platform(4);
+    std::unique_ptr<platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+
+    constexpr uint32_t kTaskCount = 1000;
+    std::atomic<uint32_t> counter = 0;
+    std::vector<std::unique_ptr<platform::WaitableEvent>> events;
+    for (uint32_t i = 0; i < kTaskCount; ++i) {
+        events.push_back(pool->PostWorkerTask(IncrementCounter, &counter));
+    }
+    for (std::unique_ptr<platform::WaitableEvent>& event : events) {
+        event->Wait();
+        EXPECT_TRUE(event->IsComplete());
+    }
+    EXPECT_EQ(kTaskCount, counter.load());
+}
+
+// Test that no more tasks run at the same time than the configured number of threads.
+TEST(WorkerTaskPoolTests, ThreadCountIsBounded) {
+    constexpr uint32_t kMaxThreadCount = 2;
+    BoundedPlatform platform(kMaxThreadCount);
+    std::unique_ptr<platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+
+    struct Concurrency {
+        std::atomic<uint32_t> current = 0;
+        std::atomic<uint32_t> max = 0;
+    } concurrency;
+    auto task = [](void* userdata) {
+        Concurrency* c = static_cast<Concurrency*>(userdata);
+        uint32_t current = c->current.fetch_add(1) + 1;
+        uint32_t max = c->max.load();
+        while (current > max && !c->max.compare_exchange_weak(max, current)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        c->current.fetch_sub(1);
+    };
+
+    std::vector<std::unique_ptr<platform::WaitableEvent>> events;
+    for (uint32_t i = 0; i < 32; ++i) {
+        events.push_back(pool->PostWorkerTask(task, &concurrency));
+    }
+    for (std::unique_ptr<platform::WaitableEvent>& event : events) {
+        WaitWithoutRunning(event.get());
+    }
+    EXPECT_LE(concurrency.max.load(), kMaxThreadCount);
+}
+
+// Test that queued tasks are started in order of priority.
+TEST(WorkerTaskPoolTests, HigherPriorityRunsFirst) {
+    BoundedPlatform platform(1);
+    std::unique_ptr<platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+
+    // Keep the only worker busy while the other tasks are queued.
+    BlockingTask blocker;
+    std::unique_ptr<platform::WaitableEvent> blockerEvent =
+        pool->PostWorkerTask(BlockingTask::Run, &blocker);
+    blocker.WaitUntilStarted();
+
+    struct Record {
+        std::mutex mutex;
+        std::vector<platform::TaskPriority> order;
+    };
+    struct Entry {
+        Record* record;
+        platform::TaskPriority priority;
+    };
+    auto task = [](void* userdata) {
+        Entry* entry = static_cast<Entry*>(userdata);
+        std::lock_guard<std::mutex> lock(entry->record->mutex);
+        entry->record->order.push_back(entry->priority);
+    };
+
+    Record record;
+    Entry entries[] = {
+        {&record, platform::TaskPriority::Low},
+        {&record, platform::TaskPriority::Normal},
+        {&record, platform::TaskPriority::High},
+    };
+    std::vector<std::unique_ptr<platform::WaitableEvent>> events;
+    for (Entry& entry : entries) {
+        events.push_back(pool->PostWorkerTaskWithPriority(task, &entry, entry.priority));
+    }
+
+    blocker.Release();
+    for (std::unique_ptr<platform::WaitableEvent>& event : events) {
+        WaitWithoutRunning(event.get());
+    }
+
+    std::vector<platform::TaskPriority> expected = {
+        platform::TaskPriority::High,
+        platform::TaskPriority::Normal,
+        platform::TaskPriority::Low,
+    };
+    EXPECT_EQ(expected, record.order);
+    blockerEvent->Wait();
+}
+
+// Test that waiting on a task that hasn't started yet runs it on the waiting thread instead of
+// blocking until a worker is available.
+TEST(WorkerTaskPoolTests, WaitRunsQueuedTask) {
+    BoundedPlatform platform(1);
+    std::unique_ptr<platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+
+    BlockingTask blocker;
+    std::unique_ptr<platform::WaitableEvent> blockerEvent =
+        pool->PostWorkerTask(BlockingTask::Run, &blocker);
+    blocker.WaitUntilStarted();
+
+    std::thread::id taskThread;
+    std::unique_ptr<platform::WaitableEvent> event = pool->PostWorkerTask(
+        [](void* userdata) {
+            *static_cast<std::thread::id*>(userdata) = std::this_thread::get_id();
+        },
+        &taskThread);
+    event->Wait();
+    EXPECT_TRUE(event->IsComplete());
+    EXPECT_EQ(std::this_thread::get_id(), taskThread);
+    EXPECT_FALSE(blockerEvent->IsComplete());
+
+    blocker.Release();
+    blockerEvent->Wait();
+    EXPECT_TRUE(blockerEvent->IsComplete());
+}
+
+// Test that destroying the pool runs the tasks that are still queued.
+TEST(WorkerTaskPoolTests, DestructionRunsQueuedTasks) {
+    BoundedPlatform platform(1);
+    std::unique_ptr<platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+
+    constexpr uint32_t kTaskCount = 100;
+    std::atomic<uint32_t> counter = 0;
+    std::vector<std::unique_ptr<platform::WaitableEvent>> events;
+    for (uint32_t i = 0; i < kTaskCount; ++i) {
+        events.push_back(pool->PostWorkerTaskWithPriority(IncrementCounter, &counter,
+                                                          platform::TaskPriority::Low));
+    }
+    pool = nullptr;
+
+    EXPECT_EQ(kTaskCount, counter.load());
+    for (std::unique_ptr<platform::WaitableEvent>& event : events) {
+        EXPECT_TRUE(event->IsComplete());
+    }
+}
+
+}  // anonymous namespace
+}  // namespace dawn
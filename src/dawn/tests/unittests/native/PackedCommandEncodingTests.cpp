@@ -0,0 +1,288 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <array>
+#include <limits>
+#include <vector>
+
+#include "dawn/native/CommandBuffer.h"
+#include "dawn/native/Commands.h"
+#include "dawn/native/Device.h"
+#include "dawn/native/RenderBundle.h"
+#include "dawn/tests/DawnNativeTest.h"
+#include "dawn/utils/ComboRenderBundleEncoderDescriptor.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn::native {
+namespace {
+
+template <typename T>
+using Fields = std::array<uint32_t, PackedCommandTraits<T>::kFieldCount>;
+
+template <typename T>
+Fields<T> GetFields(const T& cmd) {
+    Fields<T> fields;
+    PackedCommandTraits<T>::ToFields(cmd, fields.data());
+    return fields;
+}
+
+// Decodes the commands of type |id| in |commands| and skips the others.
+template <typename T>
+std::vector<Fields<T>> ReadCommands(CommandIterator* commands, Command id) {
+    std::vector<Fields<T>> result;
+    Command type;
+    while (commands->NextCommandId(&type)) {
+        if (type == id) {
+            result.push_back(GetFields(*commands->NextCommand<T>()));
+        } else {
+            SkipCommand(commands, type);
+        }
+    }
+    return result;
+}
+
+template <typename T, size_t N>
+std::vector<Fields<T>> GetAllFields(const std::array<T, N>& cmds) {
+    std::vector<Fields<T>> result;
+    for (const T& cmd : cmds) {
+        result.push_back(GetFields(cmd));
+    }
+    return result;
+}
+
+// Values that exercise the deltas: repeated, increasing, decreasing, negative and large.
+constexpr std::array<DrawCmd, 6> kDraws = {{
+    {3, 1, 0, 0},
+    {3, 1, 3, 0},
+    {3, 1, 6, 0},
+    {100000, 7, 0x7FFFFFFF, 2},
+    {1, 1, 1, 1},
+    {1, 1, 1, 1},
+}};
+constexpr std::array<DrawIndexedCmd, 5> kDrawIndexeds = {{
+    {6, 1, 0, 0, 0},
+    {6, 1, 6, -6, 0},
+    {1024, 2, 0, std::numeric_limits<int32_t>::min(), 0},
+    {12, 1, 1000, 5, 3},
+    {12, 1, 1000, 5, 3},
+}};
+constexpr std::array<DispatchCmd, 5> kDispatches = {{
+    {1, 1, 1},
+    {65535, 1, 1},
+    {2, 3, 4},
+    {1, 65535, 65535},
+    {1, 1, 1},
+}};
+
+class PackedCommandEncodingTests : public DawnNativeTest {
+  protected:
+    WGPUDevice CreateTestDevice() override {
+        const char* packedCommandEncodingToggle = "use_packed_command_encoding";
+        wgpu::DawnTogglesDescriptor deviceToggles;
+        deviceToggles.enabledToggleCount = 1;
+        deviceToggles.enabledToggles = &packedCommandEncodingToggle;
+
+        wgpu::DeviceDescriptor deviceDescriptor;
+        deviceDescriptor.nextInChain = &deviceToggles;
+        return adapter.CreateDevice(&deviceDescriptor);
+    }
+
+    void SetUp() override {
+        DawnNativeTest::SetUp();
+        ASSERT_TRUE(FromAPI(device.Get())->IsToggleEnabled(Toggle::UsePackedCommandEncoding));
+
+        utils::ComboRenderPipelineDescriptor renderPipelineDesc;
+        renderPipelineDesc.vertex.module = utils::CreateShaderModule(device, R"(
+            @vertex fn main() -> @builtin(position) vec4f {
+                return vec4f(0.0, 0.0, 0.0, 1.0);
+            })");
+        renderPipelineDesc.cFragment.module = utils::CreateShaderModule(device, R"(
+            @fragment fn main() -> @location(0) vec4f {
+                return vec4f(0.0, 1.0, 0.0, 1.0);
+            })");
+        renderPipeline = device.CreateRenderPipeline(&renderPipelineDesc);
+
+        wgpu::ComputePipelineDescriptor computePipelineDesc;
+        computePipelineDesc.compute.module = utils::CreateShaderModule(device, R"(
+            @compute @workgroup_size(1) fn main() {
+            })");
+        computePipeline = device.CreateComputePipeline(&computePipelineDesc);
+
+        wgpu::BufferDescriptor indexBufferDesc;
+        indexBufferDesc.size = 1024 * sizeof(uint32_t);
+        indexBufferDesc.usage = wgpu::BufferUsage::Index;
+        indexBuffer = device.CreateBuffer(&indexBufferDesc);
+    }
+
+    // Records kDraws and kDrawIndexeds, setting the pipeline again between the draws so that
+    // packed and regular commands are interleaved.
+    template <typename Encoder>
+    void RecordDraws(Encoder encoder) {
+        encoder.SetPipeline(renderPipeline);
+        encoder.SetIndexBuffer(indexBuffer, wgpu::IndexFormat::Uint32);
+        for (const DrawCmd& draw : kDraws) {
+            encoder.Draw(draw.vertexCount, draw.instanceCount, draw.firstVertex,
+                         draw.firstInstance);
+            encoder.SetPipeline(renderPipeline);
+        }
+        for (const DrawIndexedCmd& draw : kDrawIndexeds) {
+            encoder.DrawIndexed(draw.indexCount, draw.instanceCount, draw.firstIndex,
+                                draw.baseVertex, draw.firstInstance);
+            encoder.SetPipeline(renderPipeline);
+        }
+    }
+
+    wgpu::RenderPipeline renderPipeline;
+    wgpu::ComputePipeline computePipeline;
+    wgpu::Buffer indexBuffer;
+};
+
+// Test that draws recorded in a render pass decode to the recorded values, also when the
+// commands are iterated again after a Reset.
+TEST_F(PackedCommandEncodingTests, RenderPass) {
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 1, 1);
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+    RecordDraws(pass);
+    pass.End();
+    wgpu::CommandBuffer commandBuffer = encoder.Finish();
+
+    CommandIterator* commands = FromAPI(commandBuffer.Get())->GetCommandIteratorForTesting();
+    EXPECT_EQ(ReadCommands<DrawCmd>(commands, Command::Draw), GetAllFields(kDraws));
+    commands->Reset();
+    EXPECT_EQ(ReadCommands<DrawIndexedCmd>(commands, Command::DrawIndexed),
+              GetAllFields(kDrawIndexeds));
+}
+
+// Test that draws recorded in a render bundle decode to the recorded values, and that the bundle
+// can be executed in a render pass.
+TEST_F(PackedCommandEncodingTests, RenderBundle) {
+    utils::ComboRenderBundleEncoderDescriptor bundleDesc;
+    bundleDesc.colorFormatCount = 1;
+    bundleDesc.cColorFormats[0] = utils::BasicRenderPass::kDefaultColorFormat;
+    wgpu::RenderBundleEncoder bundleEncoder = device.CreateRenderBundleEncoder(&bundleDesc);
+    RecordDraws(bundleEncoder);
+    wgpu::RenderBundle bundle = bundleEncoder.Finish();
+
+    CommandIterator* commands = FromAPI(bundle.Get())->GetCommands();
+    EXPECT_EQ(ReadCommands<DrawCmd>(commands, Command::Draw), GetAllFields(kDraws));
+    commands->Reset();
+    EXPECT_EQ(ReadCommands<DrawIndexedCmd>(commands, Command::DrawIndexed),
+              GetAllFields(kDrawIndexeds));
+    commands->Reset();
+
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 1, 1);
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+    pass.ExecuteBundles(1, &bundle);
+    pass.End();
+    encoder.Finish();
+}
+
+// Test that dispatches recorded in a compute pass decode to the recorded values.
+TEST_F(PackedCommandEncodingTests, ComputePass) {
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+    for (const DispatchCmd& dispatch : kDispatches) {
+        pass.SetPipeline(computePipeline);
+        pass.DispatchWorkgroups(dispatch.x, dispatch.y, dispatch.z);
+    }
+    pass.End();
+    wgpu::CommandBuffer commandBuffer = encoder.Finish();
+
+    CommandIterator* commands = FromAPI(commandBuffer.Get())->GetCommandIteratorForTesting();
+    EXPECT_EQ(ReadCommands<DispatchCmd>(commands, Command::Dispatch), GetAllFields(kDispatches));
+}
+
+// Test that SkipCommand on packed commands keeps the decoding of the next ones in sync, over
+// enough draws to span several blocks.
+TEST_F(PackedCommandEncodingTests, SkipCommand) {
+    constexpr uint32_t kDrawCount = 10000;
+    auto GetDraw = [](uint32_t i) { return DrawCmd{i % 7 + 1, 1, i * 3, i % 2}; };
+
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 1, 1);
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+    pass.SetPipeline(renderPipeline);
+    pass.SetIndexBuffer(indexBuffer, wgpu::IndexFormat::Uint32);
+    for (uint32_t i = 0; i < kDrawCount; ++i) {
+        DrawCmd draw = GetDraw(i);
+        pass.Draw(draw.vertexCount, draw.instanceCount, draw.firstVertex, draw.firstInstance);
+        pass.DrawIndexed(i % 5 + 1, 1, i % 1000, -static_cast<int32_t>(i), 0);
+    }
+    pass.End();
+    wgpu::CommandBuffer commandBuffer = encoder.Finish();
+
+    // Skip every other draw and all the indexed draws.
+    CommandIterator* commands = FromAPI(commandBuffer.Get())->GetCommandIteratorForTesting();
+    uint32_t drawIndex = 0;
+    Command type;
+    while (commands->NextCommandId(&type)) {
+        if (type != Command::Draw) {
+            SkipCommand(commands, type);
+            continue;
+        }
+        if (drawIndex % 2 == 0) {
+            SkipCommand(commands, type);
+        } else {
+            ASSERT_EQ(GetFields(*commands->NextCommand<DrawCmd>()), GetFields(GetDraw(drawIndex)));
+        }
+        drawIndex++;
+    }
+    EXPECT_EQ(drawIndex, kDrawCount);
+}
+
+// Test that FreeCommands walks the packed commands after a partial iteration.
+TEST_F(PackedCommandEncodingTests, FreeCommands) {
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 1, 1);
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+    RecordDraws(pass);
+    pass.End();
+    wgpu::CommandBuffer commandBuffer = encoder.Finish();
+
+    // Stop in the middle of the draws, with the decoding state of the iterator partially updated.
+    CommandIterator* commands = FromAPI(commandBuffer.Get())->GetCommandIteratorForTesting();
+    Command type;
+    uint32_t drawCount = 0;
+    while (drawCount < 2 && commands->NextCommandId(&type)) {
+        if (type == Command::Draw) {
+            drawCount++;
+        }
+        SkipCommand(commands, type);
+    }
+
+    // FreeCommands restarts from the first command and releases the references held by the
+    // regular commands in between the packed ones.
+    FreeCommands(commands);
+    EXPECT_TRUE(commands->IsEmpty());
+    EXPECT_FALSE(commands->NextCommandId(&type));
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
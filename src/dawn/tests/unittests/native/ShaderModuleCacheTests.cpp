@@ -0,0 +1,175 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <memory>
+#include <string>
+
+#include "dawn/native/CompilationMessages.h"
+#include "dawn/native/ShaderModule.h"
+#include "gmock/gmock.h"
+#include "mocks/DawnMockTest.h"
+#include "mocks/ShaderModuleMock.h"
+
+namespace dawn::native {
+namespace {
+
+using ::testing::_;
+using ::testing::HasSubstr;
+using ::testing::Invoke;
+
+// A shader whose parse always emits a warning, so the compilation messages show whether the shader
+// was parsed.
+static constexpr char kShaderWithWarning[] = R"(
+    diagnostic(warning, derivative_uniformity);
+    @fragment fn main(@location(0) x : f32) {
+        if (x > 0.0) {
+            _ = dpdx(1.0);
+        }
+    }
+)";
+
+class ShaderModuleCacheTests : public DawnMockTest {
+  protected:
+    ResultOrError<Ref<ShaderModuleBase>> CreateShaderModule(
+        const char* source,
+        std::unique_ptr<OwnedCompilationMessages>* messages) {
+        ShaderModuleWGSLDescriptor wgslDesc = {};
+        wgslDesc.code = source;
+        ShaderModuleDescriptor desc = {};
+        desc.nextInChain = &wgslDesc;
+        return mDeviceMock->CreateShaderModule(&desc, messages);
+    }
+
+    // Expects a single call to CreateShaderModuleImpl, which checks that the shader was already
+    // parsed and validated before the backend was asked to create the module.
+    void ExpectCreateOnParsedShader() {
+        EXPECT_CALL(*mDeviceMock, CreateShaderModuleImpl(_, _, _))
+            .WillOnce(Invoke([this](const UnpackedPtr<ShaderModuleDescriptor>& descriptor,
+                                 ShaderModuleParseResult* parseResult,
+                                 OwnedCompilationMessages* messages)
+                                 -> ResultOrError<Ref<ShaderModuleBase>> {
+                EXPECT_TRUE(parseResult->HasParsedShader());
+                EXPECT_TRUE(messages->HasWarningsOrErrors());
+                return ShaderModuleMock::Create(mDeviceMock, descriptor);
+            }));
+    }
+};
+
+// Test that a cache miss parses the shader and moves its compilation messages into the module.
+TEST_F(ShaderModuleCacheTests, MissParsesShader) {
+    ExpectCreateOnParsedShader();
+
+    auto messages = std::make_unique<OwnedCompilationMessages>();
+    Ref<ShaderModuleBase> module =
+        CreateShaderModule(kShaderWithWarning, &messages).AcquireSuccess();
+
+    EXPECT_EQ(messages, nullptr);
+    EXPECT_TRUE(module->GetCompilationMessages()->HasWarningsOrErrors());
+}
+
+// Test that a cache hit returns the live module without parsing the shader again: no compilation
+// messages are produced for the second creation.
+TEST_F(ShaderModuleCacheTests, HitSkipsParse) {
+    ExpectCreateOnParsedShader();
+
+    auto messages1 = std::make_unique<OwnedCompilationMessages>();
+    Ref<ShaderModuleBase> module1 =
+        CreateShaderModule(kShaderWithWarning, &messages1).AcquireSuccess();
+
+    auto messages2 = std::make_unique<OwnedCompilationMessages>();
+    Ref<ShaderModuleBase> module2 =
+        CreateShaderModule(kShaderWithWarning, &messages2).AcquireSuccess();
+
+    EXPECT_EQ(module1.Get(), module2.Get());
+    ASSERT_NE(messages2, nullptr);
+    EXPECT_FALSE(messages2->HasWarningsOrErrors());
+}
+
+// Test that the shader is parsed again once the cached module is released.
+TEST_F(ShaderModuleCacheTests, MissAfterRelease) {
+    EXPECT_CALL(*mDeviceMock, CreateShaderModuleImpl(_, _, _)).Times(2);
+
+    auto messages = std::make_unique<OwnedCompilationMessages>();
+    CreateShaderModule(kShaderWithWarning, &messages).AcquireSuccess();
+
+    messages = std::make_unique<OwnedCompilationMessages>();
+    CreateShaderModule(kShaderWithWarning, &messages).AcquireSuccess();
+    EXPECT_EQ(messages, nullptr);
+}
+
+// Test that a parse error on the cache miss path keeps its validation context, and that the failed
+// shader is not cached: a valid shader created afterwards is parsed and created as normal.
+TEST_F(ShaderModuleCacheTests, InvalidThenValid) {
+    EXPECT_CALL(*mDeviceMock, CreateShaderModuleImpl(_, _, _)).Times(0);
+    auto messages = std::make_unique<OwnedCompilationMessages>();
+    std::string error =
+        CreateShaderModule("fn main( {", &messages).AcquireError()->GetFormattedMessage();
+    EXPECT_THAT(error, HasSubstr("Error while parsing WGSL"));
+    EXPECT_THAT(error, HasSubstr("While validating [ShaderModuleDescriptor"));
+    ASSERT_NE(messages, nullptr);
+    EXPECT_TRUE(messages->HasWarningsOrErrors());
+
+    ::testing::Mock::VerifyAndClearExpectations(mDeviceMock.get());
+    ExpectCreateOnParsedShader();
+
+    messages = std::make_unique<OwnedCompilationMessages>();
+    Ref<ShaderModuleBase> module =
+        CreateShaderModule(kShaderWithWarning, &messages).AcquireSuccess();
+    EXPECT_FALSE(module->IsError());
+}
+
+// Test that the descriptor chain is validated before the cache lookup, so that an invalid chain is
+// an error even when a module with the same content is cached.
+TEST_F(ShaderModuleCacheTests, InvalidChainOnHit) {
+    ExpectCreateOnParsedShader();
+
+    auto messages = std::make_unique<OwnedCompilationMessages>();
+    Ref<ShaderModuleBase> module =
+        CreateShaderModule(kShaderWithWarning, &messages).AcquireSuccess();
+
+    // The SPIR-V options are only allowed along with a SPIR-V descriptor.
+    DawnShaderModuleSPIRVOptionsDescriptor spirvOptions = {};
+    ShaderModuleWGSLDescriptor wgslDesc = {};
+    wgslDesc.code = kShaderWithWarning;
+    wgslDesc.nextInChain = &spirvOptions;
+    ShaderModuleDescriptor desc = {};
+    desc.nextInChain = &wgslDesc;
+    auto result = mDeviceMock->CreateShaderModule(&desc);
+    ASSERT_TRUE(result.IsError());
+    EXPECT_THAT(result.AcquireError()->GetFormattedMessage(),
+                HasSubstr("While validating [ShaderModuleDescriptor"));
+
+    // A descriptor without a WGSL or SPIR-V descriptor is an error rather than a blueprint that
+    // can't be built.
+    ShaderModuleDescriptor emptyDesc = {};
+    result = mDeviceMock->CreateShaderModule(&emptyDesc);
+    ASSERT_TRUE(result.IsError());
+    result.AcquireError();
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
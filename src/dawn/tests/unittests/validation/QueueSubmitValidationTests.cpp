@@ -25,6 +25,8 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <vector>
+
 #include "dawn/tests/unittests/validation/ValidationTest.h"
 
 #include "dawn/utils/ComboRenderPipelineDescriptor.h"
@@ -412,5 +414,82 @@ TEST_F(QueueSubmitValidationTest, SubmitWithDestroyedComputeStorageTexture) {
     }
 }
 
+class QueueSubmitParallelValidationTest : public ValidationTest {
+  protected:
+    WGPUDevice CreateTestDevice(native::Adapter dawnAdapter,
+                                wgpu::DeviceDescriptor deviceDescriptor) override {
+        const char* enabledToggles[] = {"parallel_submit_validation"};
+        wgpu::DawnTogglesDescriptor deviceTogglesDesc;
+        deviceTogglesDesc.enabledToggles = enabledToggles;
+        deviceTogglesDesc.enabledToggleCount = 1;
+        deviceDescriptor.nextInChain = &deviceTogglesDesc;
+        return dawnAdapter.CreateDevice(&deviceDescriptor);
+    }
+
+    wgpu::Buffer CreateBuffer(const char* label) {
+        wgpu::BufferDescriptor descriptor;
+        descriptor.label = label;
+        descriptor.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+        descriptor.size = 4;
+        return device.CreateBuffer(&descriptor);
+    }
+
+    wgpu::CommandBuffer CreateCopy(const wgpu::Buffer& source, const wgpu::Buffer& destination) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        encoder.CopyBufferToBuffer(source, 0, destination, 0, 4);
+        return encoder.Finish();
+    }
+
+    static constexpr uint32_t kCommandBufferCount = 16;
+};
+
+// Test that submitting many valid command buffers with parallel validation succeeds.
+TEST_F(QueueSubmitParallelValidationTest, ManyValidCommandBuffers) {
+    ASSERT_TRUE(HasToggleEnabled("parallel_submit_validation"));
+
+    wgpu::Buffer source = CreateBuffer("source");
+    wgpu::Buffer destination = CreateBuffer("destination");
+    std::vector<wgpu::CommandBuffer> commands;
+    for (uint32_t i = 0; i < kCommandBufferCount; ++i) {
+        commands.push_back(CreateCopy(source, destination));
+    }
+    device.GetQueue().Submit(commands.size(), commands.data());
+}
+
+// Test that an invalid command buffer at any position in the submit is an error.
+TEST_F(QueueSubmitParallelValidationTest, OneInvalidCommandBuffer) {
+    wgpu::Buffer source = CreateBuffer("source");
+    wgpu::Buffer destination = CreateBuffer("destination");
+    wgpu::Buffer destroyed = CreateBuffer("destroyed");
+    destroyed.Destroy();
+
+    for (uint32_t invalidIndex : {0u, kCommandBufferCount / 2, kCommandBufferCount - 1}) {
+        std::vector<wgpu::CommandBuffer> commands;
+        for (uint32_t i = 0; i < kCommandBufferCount; ++i) {
+            commands.push_back(CreateCopy(i == invalidIndex ? destroyed : source, destination));
+        }
+        ASSERT_DEVICE_ERROR(device.GetQueue().Submit(commands.size(), commands.data()));
+    }
+}
+
+// Test that the error is the one of the first invalid command buffer, like with serial validation.
+TEST_F(QueueSubmitParallelValidationTest, ErrorOfFirstInvalidCommandBuffer) {
+    wgpu::Buffer source = CreateBuffer("source");
+    wgpu::Buffer destination = CreateBuffer("destination");
+    wgpu::Buffer first = CreateBuffer("first");
+    wgpu::Buffer second = CreateBuffer("second");
+    first.Destroy();
+    second.Destroy();
+
+    std::vector<wgpu::CommandBuffer> commands;
+    for (uint32_t i = 0; i < kCommandBufferCount; ++i) {
+        commands.push_back(CreateCopy(source, destination));
+    }
+    commands[3] = CreateCopy(first, destination);
+    commands[9] = CreateCopy(second, destination);
+    ASSERT_DEVICE_ERROR(device.GetQueue().Submit(commands.size(), commands.data()),
+                        testing::HasSubstr("\"first\""));
+}
+
 }  // anonymous namespace
 }  // namespace dawn
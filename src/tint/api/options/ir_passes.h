@@ -0,0 +1,79 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_API_OPTIONS_IR_PASSES_H_
+#define SRC_TINT_API_OPTIONS_IR_PASSES_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "src/tint/utils/reflection/reflection.h"
+
+namespace tint {
+
+/// The validation performed on the IR module by the pass manager of an IR writer, in addition to the
+/// validation performed by the passes themselves in debug builds.
+enum class IRPassValidation : uint8_t {
+    /// The module is not validated.
+    kNone,
+    /// The module is validated before the first pass and after the last pass.
+    kStartAndEnd,
+    /// The module is validated before the first pass and after every pass.
+    kEachPass,
+};
+
+/// Options for the IR passes run by a writer to raise the IR module to the writer's dialect.
+struct IRPassOptions {
+    /// The validation to perform
+    IRPassValidation validation = IRPassValidation::kNone;
+
+    /// Set to `true` to record the wall time and instruction count of each pass in the writer's
+    /// output.
+    bool collect_stats = false;
+
+    /// Reflect the fields of this class so that it can be used by tint::ForeachField()
+    TINT_REFLECT(IRPassOptions, validation, collect_stats);
+};
+
+/// Reflect valid value ranges for the IRPassValidation enum.
+TINT_REFLECT_ENUM_RANGE(IRPassValidation, kNone, kEachPass);
+
+/// Statistics recorded for a single IR pass.
+struct IRPassStats {
+    /// The name of the pass.
+    std::string name;
+    /// The wall time taken by the pass.
+    std::chrono::nanoseconds duration{};
+    /// The number of instructions in the module after the pass has run.
+    size_t num_instructions = 0;
+};
+
+}  // namespace tint
+
+#endif  // SRC_TINT_API_OPTIONS_IR_PASSES_H_
@@ -43,6 +43,8 @@ tint_add_target(tint_cmd_common lib
   cmd/common/generate_external_texture_bindings.h
   cmd/common/helper.cc
   cmd/common/helper.h
+  cmd/common/split_entry_points.cc
+  cmd/common/split_entry_points.h
 )
 
 tint_target_add_dependencies(tint_cmd_common lib
@@ -75,6 +77,10 @@ tint_target_add_dependencies(tint_cmd_common lib
   tint_utils_traits
 )
 
+tint_target_add_external_dependencies(tint_cmd_common lib
+  "thread"
+)
+
 if(TINT_BUILD_SPV_READER)
   tint_target_add_dependencies(tint_cmd_common lib
     tint_lang_spirv_reader
@@ -106,6 +112,7 @@ endif(TINT_BUILD_WGSL_WRITER)
 ################################################################################
 tint_add_target(tint_cmd_common_test test
   cmd/common/generate_external_texture_bindings_test.cc
+  cmd/common/split_entry_points_test.cc
 )
 
 tint_target_add_dependencies(tint_cmd_common_test test
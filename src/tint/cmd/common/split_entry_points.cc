@@ -0,0 +1,90 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/cmd/common/split_entry_points.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace tint::cmd {
+
+std::string EntryPointOutputFile(const std::string& output_file, const std::string& entry_point) {
+    if (output_file.empty() || output_file == "-") {
+        return output_file;
+    }
+    auto dot = output_file.find_last_of('.');
+    auto slash = output_file.find_last_of("/\\");
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return output_file + "." + entry_point;
+    }
+    return output_file.substr(0, dot) + "." + entry_point + output_file.substr(dot);
+}
+
+bool GenerateEntryPoints(VectorRef<std::string> entry_points,
+                         const std::string& output_file,
+                         size_t num_threads,
+                         std::ostream& out,
+                         std::ostream& err,
+                         const std::function<bool(EntryPointJob& job)>& generate) {
+    std::vector<EntryPointJob> jobs(entry_points.Length());
+    std::vector<uint8_t> succeeded(jobs.size(), 0);
+    for (size_t i = 0; i < jobs.size(); i++) {
+        jobs[i].index = i;
+        jobs[i].entry_point = entry_points[i];
+        jobs[i].output_file = EntryPointOutputFile(output_file, entry_points[i]);
+    }
+
+    std::atomic<size_t> next_job{0};
+    auto worker = [&] {
+        for (size_t i = next_job++; i < jobs.size(); i = next_job++) {
+            succeeded[i] = generate(jobs[i]) ? 1 : 0;
+        }
+    };
+
+    num_threads = std::clamp<size_t>(num_threads, 1, std::max<size_t>(jobs.size(), 1));
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    bool success = true;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        out << jobs[i].out.str();
+        err << jobs[i].err.str();
+        success &= succeeded[i] != 0;
+    }
+    return success;
+}
+
+}  // namespace tint::cmd
@@ -0,0 +1,84 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_CMD_COMMON_SPLIT_ENTRY_POINTS_H_
+#define SRC_TINT_CMD_COMMON_SPLIT_ENTRY_POINTS_H_
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+#include "src/tint/utils/containers/vector.h"
+
+namespace tint::cmd {
+
+/// @param output_file the output file name
+/// @param entry_point the entry point name
+/// @returns `output_file` with `entry_point` inserted before the file extension, or `output_file`
+/// unmodified if the output is standard output.
+std::string EntryPointOutputFile(const std::string& output_file, const std::string& entry_point);
+
+/// The state of a single entry point's generation, passed to the callback of
+/// GenerateEntryPoints().
+struct EntryPointJob {
+    /// The index of the entry point in the list passed to GenerateEntryPoints()
+    size_t index = 0;
+    /// The name of the entry point
+    std::string entry_point;
+    /// The file that the entry point should be written to, as returned by EntryPointOutputFile()
+    std::string output_file;
+    /// The stream that text for standard output should be written to
+    std::stringstream out;
+    /// The stream that errors and other diagnostics should be written to
+    std::stringstream err;
+};
+
+/// Calls `generate` once for each of the entry points, using up to `num_threads` threads.
+/// Once every entry point has been generated, the text written to each job's `out` and `err`
+/// streams is written to `out` and `err` in entry point order, so the output does not depend on
+/// the order in which the jobs complete.
+/// @param entry_points the names of the entry points to generate
+/// @param output_file the output file name, which is split per entry point with
+/// EntryPointOutputFile()
+/// @param num_threads the maximum number of threads to use. Values of 0 are treated as 1.
+/// @param out the stream that the jobs' standard output is written to
+/// @param err the stream that the jobs' errors are written to
+/// @param generate the function called to generate each entry point, which may be called
+/// concurrently from multiple threads. Returns true on success.
+/// @returns true if `generate` returned true for every entry point
+bool GenerateEntryPoints(VectorRef<std::string> entry_points,
+                         const std::string& output_file,
+                         size_t num_threads,
+                         std::ostream& out,
+                         std::ostream& err,
+                         const std::function<bool(EntryPointJob& job)>& generate);
+
+}  // namespace tint::cmd
+
+#endif  // SRC_TINT_CMD_COMMON_SPLIT_ENTRY_POINTS_H_
@@ -0,0 +1,123 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/cmd/common/split_entry_points.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tint::cmd {
+namespace {
+
+TEST(EntryPointOutputFileTest, StandardOutput) {
+    EXPECT_EQ(EntryPointOutputFile("", "main"), "");
+    EXPECT_EQ(EntryPointOutputFile("-", "main"), "-");
+}
+
+TEST(EntryPointOutputFileTest, InsertedBeforeExtension) {
+    EXPECT_EQ(EntryPointOutputFile("shader.spv", "main"), "shader.main.spv");
+    EXPECT_EQ(EntryPointOutputFile("out/shader.msl", "vs"), "out/shader.vs.msl");
+    EXPECT_EQ(EntryPointOutputFile("a.b/shader.x.hlsl", "fs"), "a.b/shader.x.fs.hlsl");
+}
+
+TEST(EntryPointOutputFileTest, NoExtension) {
+    EXPECT_EQ(EntryPointOutputFile("shader", "main"), "shader.main");
+    EXPECT_EQ(EntryPointOutputFile("out.d/shader", "main"), "out.d/shader.main");
+    EXPECT_EQ(EntryPointOutputFile("out.d\\shader", "main"), "out.d\\shader.main");
+}
+
+TEST(GenerateEntryPointsTest, OutputFiles) {
+    std::vector<std::string> output_files(3);
+    std::stringstream out;
+    std::stringstream err;
+    bool success = GenerateEntryPoints(Vector<std::string, 3>{"a", "b", "c"}, "shader.wgsl", 2,
+                                       out, err, [&](EntryPointJob& job) {
+                                           output_files[job.index] = job.output_file;
+                                           return true;
+                                       });
+    EXPECT_TRUE(success);
+    EXPECT_EQ(output_files[0], "shader.a.wgsl");
+    EXPECT_EQ(output_files[1], "shader.b.wgsl");
+    EXPECT_EQ(output_files[2], "shader.c.wgsl");
+    EXPECT_EQ(out.str(), "");
+    EXPECT_EQ(err.str(), "");
+}
+
+// Test that the output and errors are emitted in entry point order, when the entry points complete
+// in the reverse order.
+TEST(GenerateEntryPointsTest, OutputInEntryPointOrder) {
+    constexpr size_t kCount = 4;
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t num_completed = 0;
+    std::vector<std::string> completion_order;
+
+    std::stringstream out;
+    std::stringstream err;
+    bool success = GenerateEntryPoints(
+        Vector<std::string, kCount>{"ep0", "ep1", "ep2", "ep3"}, "-", kCount, out, err,
+        [&](EntryPointJob& job) {
+            job.out << "out " << job.entry_point << "\n";
+            job.err << "err " << job.entry_point << "\n";
+
+            // Wait for all the later entry points to complete before completing this one.
+            std::unique_lock lock(mutex);
+            cv.wait(lock, [&] { return num_completed == kCount - 1 - job.index; });
+            completion_order.push_back(job.entry_point);
+            num_completed++;
+            cv.notify_all();
+            return job.index != 1;
+        });
+
+    EXPECT_FALSE(success);
+    EXPECT_EQ(completion_order, (std::vector<std::string>{"ep3", "ep2", "ep1", "ep0"}));
+    EXPECT_EQ(out.str(), "out ep0\nout ep1\nout ep2\nout ep3\n");
+    EXPECT_EQ(err.str(), "err ep0\nerr ep1\nerr ep2\nerr ep3\n");
+}
+
+TEST(GenerateEntryPointsTest, SingleThread) {
+    std::vector<std::string> call_order;
+    std::stringstream out;
+    std::stringstream err;
+    bool success = GenerateEntryPoints(Vector<std::string, 3>{"a", "b", "c"}, "-", 0, out, err,
+                                       [&](EntryPointJob& job) {
+                                           call_order.push_back(job.entry_point);
+                                           job.err << job.entry_point;
+                                           return true;
+                                       });
+    EXPECT_TRUE(success);
+    EXPECT_EQ(call_order, (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(err.str(), "abc");
+}
+
+}  // namespace
+}  // namespace tint::cmd
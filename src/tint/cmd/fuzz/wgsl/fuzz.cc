@@ -71,7 +71,9 @@ void Run(std::string_view wgsl, Slice<const std::byte> data, const Options& opti
     tint::Source::File file("test.wgsl", wgsl);
 
     // Parse the WGSL program.
-    auto program = tint::wgsl::reader::Parse(&file);
+    tint::wgsl::reader::Options parse_options;
+    parse_options.fast_fail = options.fast_fail;
+    auto program = tint::wgsl::reader::Parse(&file, parse_options);
     if (!program.IsValid()) {
         return;
     }
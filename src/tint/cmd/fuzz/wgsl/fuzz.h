@@ -80,6 +80,10 @@ struct ProgramFuzzer {
 struct Options {
     /// If true, the fuzzers will be run concurrently on separate threads.
     bool run_concurrently = false;
+    /// If true, the WGSL is parsed with fast_fail, which stops at the first error without building
+    /// detailed diagnostics. Invalid programs are discarded by the fuzzers, so this speeds up
+    /// fuzzing, but leaves the detailed diagnostic paths of the parser unfuzzed.
+    bool fast_fail = false;
 };
 
 /// Runs all the registered WGSL fuzzers with the supplied WGSL
@@ -72,6 +72,8 @@ extern "C" int LLVMFuzzerInitialize(int* argc, char*** argv) {
     auto& opt_help = opts.Add<tint::cli::BoolOption>("help", "shows the usage");
     auto& opt_concurrent =
         opts.Add<tint::cli::BoolOption>("concurrent", "runs the fuzzers concurrently");
+    auto& opt_fast_fail = opts.Add<tint::cli::BoolOption>(
+        "fast-fail", "stops parsing at the first error, without building detailed diagnostics");
 
     tint::cli::ParseOptions parse_opts;
     parse_opts.ignore_unknown = true;
@@ -87,5 +89,6 @@ extern "C" int LLVMFuzzerInitialize(int* argc, char*** argv) {
     }
 
     options.run_concurrently = opt_concurrent.value.value_or(false);
+    options.fast_fail = opt_fast_fail.value.value_or(false);
     return 0;
 }
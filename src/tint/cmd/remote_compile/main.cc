@@ -29,14 +29,16 @@
 #include <stdlib.h>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <regex>
-#include <sstream>
 #include <string>
 #include <thread>
-#include <type_traits>
+#include <utility>
 #include <vector>
 
-#if TINT_BUILD_MSL_WRITER
+#include "src/tint/cmd/remote_compile/server/server.h"
+
+#if TINT_BUILD_MSL_WRITER && TINT_BUILD_IS_MAC
 #include "src/tint/lang/msl/validate/validate.h"
 #endif
 
@@ -45,13 +47,17 @@
 
 namespace {
 
-/// The return structure of a compile function
-struct CompileResult {
-    /// True if shader compiled
-    bool success = false;
-    /// Output of the compiler
-    std::string output;
-};
+using tint::remote_compile::BatchCompileRequest;
+using tint::remote_compile::CompileRequest;
+using tint::remote_compile::CompileResult;
+using tint::remote_compile::ConnectionRequest;
+using tint::remote_compile::kProtocolVersion;
+using tint::remote_compile::Send;
+using tint::remote_compile::Server;
+using tint::remote_compile::ServerOptions;
+using tint::remote_compile::SourceLanguage;
+using tint::remote_compile::StatsRequest;
+using tint::remote_compile::Stream;
 
 /// Print the tool usage, and exit with 1.
 [[noreturn]] void ShowUsage() {
@@ -59,284 +65,117 @@ struct CompileResult {
     printf(R"(%s is a tool for compiling a shader on a remote machine
 
 usage as server:
-  %s -s [-p port-number]
+  %s -s [-p port-number] [-j jobs] [--cache-size entries]
+        [--cache-dir path] [--disk-cache-size entries]
+
+  -j, --jobs         number of compiler threads. Defaults to the number of cores.
+  --cache-size       number of results held in the in-memory cache. Default: 1024.
+                     0 disables the in-memory cache.
+  --cache-dir        directory of the on-disk result cache. Disabled if omitted.
+  --disk-cache-size  number of results held in the on-disk cache. Default: 65536.
 
 usage as client:
-  %s [-p port-number] [server-address] shader-file-path
+  %s [-p port-number] [server-address] shader-file-path...
+  %s [-p port-number] [server-address] --stats
 
   [server-address] can be omitted if the TINT_REMOTE_COMPILE_ADDRESS environment
-  variable is set.
+  variable is set, and a single shader file is compiled.
+  Multiple shader files are sent to the server as a single batch request.
+  --stats prints the server's queue depth, latency and cache counters.
   Alternatively, you can pass xcrun arguments so %s can be used as a
   drop-in replacement.
 )",
-           name, name, name, name);
+           name, name, name, name, name);
     exit(1);
 }
 
-/// The protocol version code. Bump each time the protocol changes
-constexpr uint32_t kProtocolVersion = 1;
-
-/// Supported shader source languages
-enum SourceLanguage : uint8_t {
-    MSL,
-};
-
-/// Stream is a serialization wrapper around a socket
-struct Stream {
-    /// The underlying socket
-    tint::socket::Socket* const socket;
-    /// Error state
-    std::string error;
-
-    /// Writes a uint32_t to the socket
-    Stream operator<<(uint32_t v) {
-        if (error.empty()) {
-            Write(&v, sizeof(v));
-        }
-        return *this;
-    }
-
-    /// Reads a uint32_t from the socket
-    Stream operator>>(uint32_t& v) {
-        if (error.empty()) {
-            Read(&v, sizeof(v));
-        }
-        return *this;
-    }
-
-    /// Writes a std::string to the socket
-    Stream operator<<(const std::string& v) {
-        if (error.empty()) {
-            uint32_t count = static_cast<uint32_t>(v.size());
-            *this << count;
-            if (count) {
-                Write(v.data(), count);
-            }
-        }
-        return *this;
-    }
-
-    /// Reads a std::string from the socket
-    Stream operator>>(std::string& v) {
-        uint32_t count = 0;
-        *this >> count;
-        if (count) {
-            std::vector<char> buf(count);
-            if (Read(buf.data(), count)) {
-                v = std::string(buf.data(), buf.size());
-            }
-        } else {
-            v.clear();
-        }
-        return *this;
-    }
-
-    /// Writes an enum value to the socket
-    template <typename T>
-    std::enable_if_t<std::is_enum<T>::value, Stream> operator<<(T e) {
-        return *this << static_cast<uint32_t>(e);
-    }
-
-    /// Reads an enum value from the socket
-    template <typename T>
-    std::enable_if_t<std::is_enum<T>::value, Stream> operator>>(T& e) {
-        uint32_t v;
-        *this >> v;
-        e = static_cast<T>(v);
-        return *this;
-    }
-
-  private:
-    bool Write(const void* data, size_t size) {
-        if (error.empty()) {
-            if (!socket->Write(data, size)) {
-                error = "Socket::Write() failed";
-            }
-        }
-        return error.empty();
-    }
-
-    bool Read(void* data, size_t size) {
-        auto buf = reinterpret_cast<uint8_t*>(data);
-        while (size > 0 && error.empty()) {
-            if (auto n = socket->Read(buf, size)) {
-                if (n > size) {
-                    error = "Socket::Read() returned more bytes than requested";
-                    return false;
-                }
-                size -= n;
-                buf += n;
-            } else {
-                error = "Socket::Read() failed";
-            }
-        }
-        return error.empty();
-    }
-};
-
-////////////////////////////////////////////////////////////////////////////////
-// Messages
-////////////////////////////////////////////////////////////////////////////////
-
-/// Base class for all messages
-struct Message {
-    /// The type of the message
-    enum class Type : uint8_t {
-        ConnectionRequest,
-        ConnectionResponse,
-        CompileRequest,
-        CompileResponse,
-    };
-
-    explicit Message(Type ty) : type(ty) {}
-
-    const Type type;
-};
-
-struct ConnectionResponse : Message {  // Server -> Client
-    ConnectionResponse() : Message(Type::ConnectionResponse) {}
-
-    template <typename T>
-    void Serialize(T&& f) {
-        f(error);
-    }
-
-    std::string error;
-};
-
-struct ConnectionRequest : Message {  // Client -> Server
-    using Response = ConnectionResponse;
-
-    explicit ConnectionRequest(uint32_t proto_ver = kProtocolVersion)
-        : Message(Type::ConnectionRequest), protocol_version(proto_ver) {}
-
-    template <typename T>
-    void Serialize(T&& f) {
-        f(protocol_version);
-    }
-
-    uint32_t protocol_version;
-};
-
-struct CompileResponse : Message {  //  Server -> Client
-    CompileResponse() : Message(Type::CompileResponse) {}
-
-    template <typename T>
-    void Serialize(T&& f) {
-        f(error);
-    }
-
-    std::string error;
-};
-
-struct CompileRequest : Message {  // Client -> Server
-    using Response = CompileResponse;
-
-    CompileRequest() : Message(Type::CompileRequest) {}
-    CompileRequest(SourceLanguage lang, int ver_major, int ver_minor, std::string src)
-        : Message(Type::CompileRequest),
-          language(lang),
-          version_major(uint32_t(ver_major)),
-          version_minor(uint32_t(ver_minor)),
-          source(src) {}
-
-    template <typename T>
-    void Serialize(T&& f) {
-        f(language);
-        f(source);
-        f(version_major);
-        f(version_minor);
-    }
-
-    SourceLanguage language = SourceLanguage::MSL;
-    uint32_t version_major = 0;
-    uint32_t version_minor = 0;
-    std::string source;
-};
-
-/// Writes the message `m` to the stream `s`
-template <typename MESSAGE>
-std::enable_if_t<std::is_base_of<Message, MESSAGE>::value, Stream>& operator<<(Stream& s,
-                                                                               const MESSAGE& m) {
-    s << m.type;
-    const_cast<MESSAGE&>(m).Serialize([&s](const auto& value) { s << value; });
-    return s;
-}
-
-/// Reads the message `m` from the stream `s`
-template <typename MESSAGE>
-std::enable_if_t<std::is_base_of<Message, MESSAGE>::value, Stream>& operator>>(Stream& s,
-                                                                               MESSAGE& m) {
-    Message::Type ty;
-    s >> ty;
-    if (s.error.empty()) {
-        if (ty == m.type) {
-            m.Serialize([&s](auto& value) { s >> value; });
-        } else {
-            std::stringstream ss;
-            ss << "Expected message type " << static_cast<int>(m.type) << ", got "
-               << static_cast<int>(ty);
-            s.error = ss.str();
+#if TINT_BUILD_MSL_WRITER && TINT_BUILD_IS_MAC
+/// Compiles the shader of the request `req` with the Metal compiler
+/// @returns the result of the compilation
+CompileResult CompileWithMetal(const CompileRequest& req) {
+    if (req.language == SourceLanguage::MSL) {
+        auto version = tint::msl::validate::MslVersion::kMsl_1_2;
+        if (req.version_major == 2 && req.version_minor == 1) {
+            version = tint::msl::validate::MslVersion::kMsl_2_1;
         }
-    }
-    return s;
-}
-
-/// Writes the request message `req` to the stream `s`, then reads and returns
-/// the response message from the same stream.
-template <typename REQUEST, typename RESPONSE = typename REQUEST::Response>
-RESPONSE Send(Stream& s, const REQUEST& req) {
-    s << req;
-    if (s.error.empty()) {
-        RESPONSE resp;
-        s >> resp;
-        if (s.error.empty()) {
-            return resp;
+        if (req.version_major == 2 && req.version_minor == 3) {
+            version = tint::msl::validate::MslVersion::kMsl_2_3;
         }
+        auto result = tint::msl::validate::ValidateUsingMetal(req.source, version);
+        return CompileResult{!result.failed, result.output};
     }
-    return {};
+    return CompileResult{false, tint::remote_compile::kCannotCompile};
 }
+#endif
 
 }  // namespace
 
-bool RunServer(std::string port, bool verbose);
+bool RunServer(const ServerOptions& options);
 bool RunClient(std::string address,
                std::string port,
-               std::string file,
+               std::vector<std::string> files,
                int version_major,
                int version_minor,
                bool verbose);
+bool RunStatsClient(std::string address, std::string port, bool verbose);
 
 int main(int argc, char* argv[]) {
     bool run_server = false;
+    bool stats = false;
     bool verbose = false;
     int version_major = 0;
     int version_minor = 0;
     std::string port = "19000";
+    ServerOptions server_options;
 
     std::regex metal_version_re{"^-?-std=macos-metal([0-9]+)\\.([0-9]+)"};
 
     std::vector<std::string> args;
     for (int i = 1; i < argc; i++) {
         std::string arg = argv[i];
+        // Returns the value of a flag that takes a value, or exits if the value is missing.
+        auto value = [&](const char* what) {
+            if (i < argc - 1) {
+                i++;
+                return std::string(argv[i]);
+            }
+            printf("expected %s", what);
+            exit(1);
+        };
         if (arg == "-s" || arg == "--server") {
             run_server = true;
             continue;
         }
         if (arg == "-p" || arg == "--port") {
-            if (i < argc - 1) {
-                i++;
-                port = argv[i];
-            } else {
-                printf("expected port number");
-                exit(1);
-            }
+            port = value("port number");
             continue;
         }
         if (arg == "-v" || arg == "--verbose") {
             verbose = true;
             continue;
         }
+        if (arg == "-j" || arg == "--jobs") {
+            server_options.jobs = std::strtoull(value("number of jobs").c_str(), nullptr, 10);
+            continue;
+        }
+        if (arg == "--cache-size") {
+            server_options.memory_cache_entries =
+                std::strtoull(value("cache size").c_str(), nullptr, 10);
+            continue;
+        }
+        if (arg == "--cache-dir") {
+            server_options.cache_dir = value("cache directory");
+            continue;
+        }
+        if (arg == "--disk-cache-size") {
+            server_options.disk_cache_entries =
+                std::strtoull(value("disk cache size").c_str(), nullptr, 10);
+            continue;
+        }
+        if (arg == "--stats") {
+            stats = true;
+            continue;
+        }
 
         // xcrun flags are ignored so this executable can be used as a replacement for xcrun.
         if ((arg == "-x" || arg == "-sdk") && (i < argc - 1)) {
@@ -366,31 +205,55 @@ int main(int argc, char* argv[]) {
     bool success = false;
 
     if (run_server) {
-        success = RunServer(port, verbose);
+        server_options.port = port;
+        server_options.verbose = verbose;
+#if TINT_BUILD_MSL_WRITER && TINT_BUILD_IS_MAC
+        server_options.compile = CompileWithMetal;
+#endif
+        success = RunServer(server_options);
     } else {
         std::string address;
-        std::string file;
-        switch (args.size()) {
-            case 1:
-                TINT_BEGIN_DISABLE_WARNING(DEPRECATED);
-                if (auto* addr = getenv("TINT_REMOTE_COMPILE_ADDRESS")) {
-                    address = addr;
-                }
-                TINT_END_DISABLE_WARNING(DEPRECATED);
-                file = args[0];
-                break;
-            case 2:
-                address = args[0];
-                file = args[1];
-                break;
-            default:
-                std::cerr << "Expected 1 or 2 arguments, got " << args.size() << "\n\n";
-                ShowUsage();
+        TINT_BEGIN_DISABLE_WARNING(DEPRECATED);
+        if (auto* addr = getenv("TINT_REMOTE_COMPILE_ADDRESS")) {
+            address = addr;
         }
-        if (address.empty() || file.empty()) {
-            ShowUsage();
+        TINT_END_DISABLE_WARNING(DEPRECATED);
+
+        if (stats) {
+            switch (args.size()) {
+                case 0:
+                    break;
+                case 1:
+                    address = args[0];
+                    break;
+                default:
+                    std::cerr << "Expected 0 or 1 arguments with --stats, got " << args.size()
+                              << "\n\n";
+                    ShowUsage();
+            }
+            if (address.empty()) {
+                ShowUsage();
+            }
+            success = RunStatsClient(address, port, verbose);
+        } else {
+            std::vector<std::string> files;
+            switch (args.size()) {
+                case 0:
+                    std::cerr << "Expected at least 1 argument, got 0\n\n";
+                    ShowUsage();
+                case 1:
+                    files = args;
+                    break;
+                default:
+                    address = args[0];
+                    files.assign(args.begin() + 1, args.end());
+                    break;
+            }
+            if (address.empty()) {
+                ShowUsage();
+            }
+            success = RunClient(address, port, files, version_major, version_minor, verbose);
         }
-        success = RunClient(address, port, file, version_major, version_minor, verbose);
     }
 
     if (!success) {
@@ -400,100 +263,28 @@ int main(int argc, char* argv[]) {
     return 0;
 }
 
-bool RunServer(std::string port, bool verbose) {
-    auto server_socket = tint::socket::Socket::Listen("", port.c_str());
+bool RunServer(const ServerOptions& options) {
+    auto server_socket = tint::socket::Socket::Listen("", options.port.c_str());
     if (!server_socket) {
-        std::cout << "Failed to listen on port " << port << "\n";
+        std::cout << "Failed to listen on port " << options.port << "\n";
         return false;
     }
-    std::cout << "Listening on port " << port.c_str() << "...\n";
+    // The server is shared with the connection threads, which may outlive this function.
+    auto server = std::make_shared<Server>(options);
+    std::cout << "Listening on port " << options.port.c_str() << "...\n";
     while (auto conn = server_socket->Accept()) {
-        std::thread([=] {
-            auto tid = std::this_thread::get_id();
-            if (verbose) {
-                std::cout << tid << " Client connected...\n";
-            }
-            Stream stream{conn.get(), ""};
-
-            {
-                ConnectionRequest req;
-                stream >> req;
-                if (!stream.error.empty()) {
-                    if (verbose) {
-                        std::cout << tid << " Error: " << stream.error << "\n";
-                    }
-                    return;
-                }
-                ConnectionResponse resp;
-                if (req.protocol_version != kProtocolVersion) {
-                    if (verbose) {
-                        std::cout << tid << " Protocol version mismatch. requested: "
-                                  << req.protocol_version << "\n";
-                    }
-                    resp.error = "Protocol version mismatch";
-                    stream << resp;
-                    return;
-                }
-                stream << resp;
-            }
-            if (verbose) {
-                std::cout << tid << " Connection established\n";
-            }
-            {
-                CompileRequest req;
-                stream >> req;
-                if (!stream.error.empty()) {
-                    if (verbose) {
-                        std::cout << tid << " Error: " << stream.error << "\n";
-                    }
-                    return;
-                }
-#if TINT_BUILD_MSL_WRITER && TINT_BUILD_IS_MAC
-                if (req.language == SourceLanguage::MSL) {
-                    auto version = tint::msl::validate::MslVersion::kMsl_1_2;
-                    if (req.version_major == 2 && req.version_minor == 1) {
-                        version = tint::msl::validate::MslVersion::kMsl_2_1;
-                    }
-                    if (req.version_major == 2 && req.version_minor == 3) {
-                        version = tint::msl::validate::MslVersion::kMsl_2_3;
-                    }
-                    auto result = tint::msl::validate::ValidateUsingMetal(req.source, version);
-                    CompileResponse resp;
-                    if (result.failed) {
-                        resp.error = result.output;
-                    }
-                    stream << resp;
-
-                    if (verbose) {
-                        std::cout << tid << " Shader compilation "
-                                  << (result.failed ? "failed" : "passed") << "\n";
-                    }
-                    return;
-                }
-#endif
-                CompileResponse resp;
-                resp.error = "server cannot compile this type of shader";
-                stream << resp;
-            }
-        }).detach();
+        std::thread([=] { server->Serve(conn.get()); }).detach();
     }
     return true;
 }
 
-bool RunClient(std::string address,
-               std::string port,
-               std::string file,
-               int version_major,
-               int version_minor,
-               bool verbose) {
-    // Read the file
-    std::ifstream input(file, std::ios::binary);
-    if (!input) {
-        std::cerr << "Couldn't open '" << file << "'\n";
-        return false;
-    }
-    std::string source((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+namespace {
 
+/// Connects to the server, and performs the connection handshake.
+/// @returns the connection to the server, or nullptr on failure
+std::shared_ptr<tint::socket::Socket> ConnectToServer(const std::string& address,
+                                                      const std::string& port,
+                                                      bool verbose) {
     constexpr const int timeout_ms = 100'000;
     if (verbose) {
         std::cout << "Connecting to " << address << ":" << port << "\n";
@@ -501,7 +292,7 @@ bool RunClient(std::string address,
     auto conn = tint::socket::Socket::Connect(address.c_str(), port.c_str(), timeout_ms);
     if (!conn) {
         std::cerr << "Connection failed\n";
-        return false;
+        return nullptr;
     }
 
     Stream stream{conn.get(), ""};
@@ -512,27 +303,108 @@ bool RunClient(std::string address,
     auto conn_resp = Send(stream, ConnectionRequest{kProtocolVersion});
     if (!stream.error.empty()) {
         std::cerr << stream.error << "\n";
-        return false;
+        return nullptr;
     }
     if (!conn_resp.error.empty()) {
         std::cerr << conn_resp.error << "\n";
-        return false;
+        return nullptr;
     }
-    if (verbose) {
-        std::cout << "Connection established. Requesting compile...\n";
+    return conn;
+}
+
+}  // namespace
+
+bool RunClient(std::string address,
+               std::string port,
+               std::vector<std::string> files,
+               int version_major,
+               int version_minor,
+               bool verbose) {
+    // Read the files
+    BatchCompileRequest batch;
+    for (auto& file : files) {
+        std::ifstream input(file, std::ios::binary);
+        if (!input) {
+            std::cerr << "Couldn't open '" << file << "'\n";
+            return false;
+        }
+        std::string source((std::istreambuf_iterator<char>(input)),
+                           std::istreambuf_iterator<char>());
+        batch.shaders.emplace_back(SourceLanguage::MSL, version_major, version_minor, source);
     }
-    auto comp_resp =
-        Send(stream, CompileRequest{SourceLanguage::MSL, version_major, version_minor, source});
-    if (!stream.error.empty()) {
-        std::cerr << stream.error << "\n";
+
+    auto conn = ConnectToServer(address, port, verbose);
+    if (!conn) {
         return false;
     }
-    if (!comp_resp.error.empty()) {
-        std::cerr << comp_resp.error << "\n";
-        return false;
+    Stream stream{conn.get(), ""};
+
+    if (batch.shaders.size() == 1) {
+        if (verbose) {
+            std::cout << "Connection established. Requesting compile...\n";
+        }
+        auto comp_resp = Send(stream, batch.shaders[0]);
+        if (!stream.error.empty()) {
+            std::cerr << stream.error << "\n";
+            return false;
+        }
+        if (!comp_resp.error.empty()) {
+            std::cerr << comp_resp.error << "\n";
+            return false;
+        }
+    } else {
+        if (verbose) {
+            std::cout << "Connection established. Requesting compile of " << batch.shaders.size()
+                      << " shaders...\n";
+        }
+        auto batch_resp = Send(stream, batch);
+        if (!stream.error.empty()) {
+            std::cerr << stream.error << "\n";
+            return false;
+        }
+        if (batch_resp.results.size() != files.size()) {
+            std::cerr << "Expected " << files.size() << " results, got "
+                      << batch_resp.results.size() << "\n";
+            return false;
+        }
+        bool success = true;
+        for (size_t i = 0; i < files.size(); i++) {
+            if (!batch_resp.results[i].error.empty()) {
+                std::cerr << files[i] << ": " << batch_resp.results[i].error << "\n";
+                success = false;
+            }
+        }
+        if (!success) {
+            return false;
+        }
     }
     if (verbose) {
         std::cout << "Compilation successful\n";
     }
     return true;
 }
+
+bool RunStatsClient(std::string address, std::string port, bool verbose) {
+    auto conn = ConnectToServer(address, port, verbose);
+    if (!conn) {
+        return false;
+    }
+    Stream stream{conn.get(), ""};
+    auto resp = Send(stream, StatsRequest{});
+    if (!stream.error.empty()) {
+        std::cerr << stream.error << "\n";
+        return false;
+    }
+    uint64_t mean_latency_us = resp.shaders > 0 ? resp.total_latency_us / resp.shaders : 0;
+    std::cout << "workers:           " << resp.workers << "\n"
+              << "queue depth:       " << resp.queue_depth << "\n"
+              << "requests:          " << resp.requests << "\n"
+              << "shaders:           " << resp.shaders << "\n"
+              << "compiles:          " << resp.compiles << "\n"
+              << "memory cache hits: " << resp.memory_cache_hits << "\n"
+              << "disk cache hits:   " << resp.disk_cache_hits << "\n"
+              << "cache misses:      " << resp.cache_misses << "\n"
+              << "mean latency:      " << mean_latency_us << "us\n"
+              << "max latency:       " << resp.max_latency_us << "us\n";
+    return true;
+}
@@ -0,0 +1,73 @@
+# Copyright 2026 The Dawn & Tint Authors
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+################################################################################
+# File generated by 'tools/src/cmd/gen' using the template:
+#   tools/src/cmd/gen/build/BUILD.cmake.tmpl
+#
+# To regenerate run: './tools/run gen'
+#
+#                       Do not modify this file directly
+################################################################################
+
+################################################################################
+# Target:    tint_cmd_remote_compile_server
+# Kind:      lib
+################################################################################
+tint_add_target(tint_cmd_remote_compile_server lib
+  cmd/remote_compile/server/protocol.h
+  cmd/remote_compile/server/server.cc
+  cmd/remote_compile/server/server.h
+)
+
+tint_target_add_dependencies(tint_cmd_remote_compile_server lib
+  tint_utils_macros
+  tint_utils_socket
+)
+
+tint_target_add_external_dependencies(tint_cmd_remote_compile_server lib
+  "thread"
+)
+
+################################################################################
+# Target:    tint_cmd_remote_compile_server_test
+# Kind:      test
+################################################################################
+tint_add_target(tint_cmd_remote_compile_server_test test
+  cmd/remote_compile/server/server_test.cc
+)
+
+tint_target_add_dependencies(tint_cmd_remote_compile_server_test test
+  tint_cmd_remote_compile_server
+  tint_utils_macros
+  tint_utils_socket
+)
+
+tint_target_add_external_dependencies(tint_cmd_remote_compile_server_test test
+  "gtest"
+  "thread"
+)
@@ -0,0 +1,397 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_CMD_REMOTE_COMPILE_SERVER_PROTOCOL_H_
+#define SRC_TINT_CMD_REMOTE_COMPILE_SERVER_PROTOCOL_H_
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "src/tint/utils/socket/socket.h"
+
+namespace tint::remote_compile {
+
+/// The return structure of a compile function
+struct CompileResult {
+    /// True if shader compiled
+    bool success = false;
+    /// Output of the compiler
+    std::string output;
+};
+
+/// The protocol version code. Bump each time the protocol changes
+constexpr uint32_t kProtocolVersion = 2;
+
+/// Supported shader source languages
+enum SourceLanguage : uint8_t {
+    MSL,
+};
+
+/// Stream is a serialization wrapper around a socket
+struct Stream {
+    /// The underlying socket
+    tint::socket::Socket* const socket;
+    /// Error state
+    std::string error;
+
+    /// Writes a uint32_t to the socket
+    Stream operator<<(uint32_t v) {
+        if (error.empty()) {
+            Write(&v, sizeof(v));
+        }
+        return *this;
+    }
+
+    /// Reads a uint32_t from the socket
+    Stream operator>>(uint32_t& v) {
+        if (error.empty()) {
+            Read(&v, sizeof(v));
+        }
+        return *this;
+    }
+
+    /// Writes a uint64_t to the socket
+    Stream operator<<(uint64_t v) {
+        if (error.empty()) {
+            Write(&v, sizeof(v));
+        }
+        return *this;
+    }
+
+    /// Reads a uint64_t from the socket
+    Stream operator>>(uint64_t& v) {
+        if (error.empty()) {
+            Read(&v, sizeof(v));
+        }
+        return *this;
+    }
+
+    /// Writes a std::string to the socket
+    Stream operator<<(const std::string& v) {
+        if (error.empty()) {
+            uint32_t count = static_cast<uint32_t>(v.size());
+            *this << count;
+            if (count) {
+                Write(v.data(), count);
+            }
+        }
+        return *this;
+    }
+
+    /// Reads a std::string from the socket
+    Stream operator>>(std::string& v) {
+        uint32_t count = 0;
+        *this >> count;
+        if (count) {
+            std::vector<char> buf(count);
+            if (Read(buf.data(), count)) {
+                v = std::string(buf.data(), buf.size());
+            }
+        } else {
+            v.clear();
+        }
+        return *this;
+    }
+
+    /// Writes an enum value to the socket
+    template <typename T>
+    std::enable_if_t<std::is_enum<T>::value, Stream> operator<<(T e) {
+        return *this << static_cast<uint32_t>(e);
+    }
+
+    /// Reads an enum value from the socket
+    template <typename T>
+    std::enable_if_t<std::is_enum<T>::value, Stream> operator>>(T& e) {
+        uint32_t v;
+        *this >> v;
+        e = static_cast<T>(v);
+        return *this;
+    }
+
+    /// Writes a std::vector of serializable structures to the socket
+    template <typename T>
+    Stream operator<<(const std::vector<T>& v) {
+        *this << static_cast<uint32_t>(v.size());
+        for (auto& el : v) {
+            const_cast<T&>(el).Serialize([this](const auto& value) { *this << value; });
+        }
+        return *this;
+    }
+
+    /// Reads a std::vector of serializable structures from the socket
+    template <typename T>
+    Stream operator>>(std::vector<T>& v) {
+        uint32_t count = 0;
+        *this >> count;
+        v.clear();
+        for (uint32_t i = 0; i < count && error.empty(); i++) {
+            v.emplace_back().Serialize([this](auto& value) { *this >> value; });
+        }
+        return *this;
+    }
+
+  private:
+    bool Write(const void* data, size_t size) {
+        if (error.empty()) {
+            if (!socket->Write(data, size)) {
+                error = "Socket::Write() failed";
+            }
+        }
+        return error.empty();
+    }
+
+    bool Read(void* data, size_t size) {
+        auto buf = reinterpret_cast<uint8_t*>(data);
+        while (size > 0 && error.empty()) {
+            if (auto n = socket->Read(buf, size)) {
+                if (n > size) {
+                    error = "Socket::Read() returned more bytes than requested";
+                    return false;
+                }
+                size -= n;
+                buf += n;
+            } else {
+                error = "Socket::Read() failed";
+            }
+        }
+        return error.empty();
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Messages
+////////////////////////////////////////////////////////////////////////////////
+
+/// Base class for all messages
+struct Message {
+    /// The type of the message
+    enum class Type : uint8_t {
+        ConnectionRequest,
+        ConnectionResponse,
+        CompileRequest,
+        CompileResponse,
+        BatchCompileRequest,
+        BatchCompileResponse,
+        StatsRequest,
+        StatsResponse,
+    };
+
+    explicit Message(Type ty) : type(ty) {}
+
+    const Type type;
+};
+
+struct ConnectionResponse : Message {  // Server -> Client
+    ConnectionResponse() : Message(Type::ConnectionResponse) {}
+
+    template <typename T>
+    void Serialize(T&& f) {
+        f(error);
+    }
+
+    std::string error;
+};
+
+struct ConnectionRequest : Message {  // Client -> Server
+    using Response = ConnectionResponse;
+
+    explicit ConnectionRequest(uint32_t proto_ver = kProtocolVersion)
+        : Message(Type::ConnectionRequest), protocol_version(proto_ver) {}
+
+    template <typename T>
+    void Serialize(T&& f) {
+        f(protocol_version);
+    }
+
+    uint32_t protocol_version;
+};
+
+struct CompileResponse : Message {  //  Server -> Client
+    CompileResponse() : Message(Type::CompileResponse) {}
+
+    template <typename T>
+    void Serialize(T&& f) {
+        f(error);
+    }
+
+    std::string error;
+};
+
+struct CompileRequest : Message {  // Client -> Server
+    using Response = CompileResponse;
+
+    CompileRequest() : Message(Type::CompileRequest) {}
+    CompileRequest(SourceLanguage lang, int ver_major, int ver_minor, std::string src)
+        : Message(Type::CompileRequest),
+          language(lang),
+          version_major(uint32_t(ver_major)),
+          version_minor(uint32_t(ver_minor)),
+          source(src) {}
+
+    template <typename T>
+    void Serialize(T&& f) {
+        f(language);
+        f(source);
+        f(version_major);
+        f(version_minor);
+    }
+
+    SourceLanguage language = SourceLanguage::MSL;
+    uint32_t version_major = 0;
+    uint32_t version_minor = 0;
+    std::string source;
+};
+
+struct BatchCompileResponse : Message {  //  Server -> Client
+    BatchCompileResponse() : Message(Type::BatchCompileResponse) {}
+
+    template <typename T>
+    void Serialize(T&& f) {
+        f(results);
+    }
+
+    /// The result of each shader, in the order of BatchCompileRequest::shaders
+    std::vector<CompileResponse> results;
+};
+
+struct BatchCompileRequest : Message {  // Client -> Server
+    using Response = BatchCompileResponse;
+
+    BatchCompileRequest() : Message(Type::BatchCompileRequest) {}
+
+    template <typename T>
+    void Serialize(T&& f) {
+        f(shaders);
+    }
+
+    std::vector<CompileRequest> shaders;
+};
+
+struct StatsResponse : Message {  //  Server -> Client
+    StatsResponse() : Message(Type::StatsResponse) {}
+
+    template <typename T>
+    void Serialize(T&& f) {
+        f(workers);
+        f(queue_depth);
+        f(requests);
+        f(shaders);
+        f(compiles);
+        f(memory_cache_hits);
+        f(disk_cache_hits);
+        f(cache_misses);
+        f(total_latency_us);
+        f(max_latency_us);
+    }
+
+    /// The number of compiler threads
+    uint64_t workers = 0;
+    /// The number of shaders waiting for a compiler thread
+    uint64_t queue_depth = 0;
+    /// The number of compile and batch compile requests served
+    uint64_t requests = 0;
+    /// The number of shaders served, including those served from a cache
+    uint64_t shaders = 0;
+    /// The number of shaders compiled
+    uint64_t compiles = 0;
+    /// The number of shaders served from the in-memory cache
+    uint64_t memory_cache_hits = 0;
+    /// The number of shaders served from the on-disk cache
+    uint64_t disk_cache_hits = 0;
+    /// The number of shaders not found in either cache
+    uint64_t cache_misses = 0;
+    /// The sum of the time taken to serve each shader, in microseconds
+    uint64_t total_latency_us = 0;
+    /// The longest time taken to serve a single shader, in microseconds
+    uint64_t max_latency_us = 0;
+};
+
+struct StatsRequest : Message {  // Client -> Server
+    using Response = StatsResponse;
+
+    StatsRequest() : Message(Type::StatsRequest) {}
+
+    template <typename T>
+    void Serialize(T&&) {}
+};
+
+/// Writes the message `m` to the stream `s`
+template <typename MESSAGE>
+std::enable_if_t<std::is_base_of<Message, MESSAGE>::value, Stream>& operator<<(Stream& s,
+                                                                               const MESSAGE& m) {
+    s << m.type;
+    const_cast<MESSAGE&>(m).Serialize([&s](const auto& value) { s << value; });
+    return s;
+}
+
+/// Reads the body of the message `m` from the stream `s`, where the message type has already been
+/// read from the stream.
+template <typename MESSAGE>
+Stream& ReadBody(Stream& s, MESSAGE& m) {
+    m.Serialize([&s](auto& value) { s >> value; });
+    return s;
+}
+
+/// Reads the message `m` from the stream `s`
+template <typename MESSAGE>
+std::enable_if_t<std::is_base_of<Message, MESSAGE>::value, Stream>& operator>>(Stream& s,
+                                                                               MESSAGE& m) {
+    Message::Type ty;
+    s >> ty;
+    if (s.error.empty()) {
+        if (ty == m.type) {
+            ReadBody(s, m);
+        } else {
+            std::stringstream ss;
+            ss << "Expected message type " << static_cast<int>(m.type) << ", got "
+               << static_cast<int>(ty);
+            s.error = ss.str();
+        }
+    }
+    return s;
+}
+
+/// Writes the request message `req` to the stream `s`, then reads and returns
+/// the response message from the same stream.
+template <typename REQUEST, typename RESPONSE = typename REQUEST::Response>
+RESPONSE Send(Stream& s, const REQUEST& req) {
+    s << req;
+    if (s.error.empty()) {
+        RESPONSE resp;
+        s >> resp;
+        if (s.error.empty()) {
+            return resp;
+        }
+    }
+    return {};
+}
+
+}  // namespace tint::remote_compile
+
+#endif  // SRC_TINT_CMD_REMOTE_COMPILE_SERVER_PROTOCOL_H_
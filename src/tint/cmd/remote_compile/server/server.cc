@@ -0,0 +1,466 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/cmd/remote_compile/server/server.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+namespace tint::remote_compile {
+namespace {
+
+/// @returns the CompileResponse::error for the compilation result `result`
+std::string ErrorOf(const CompileResult& result) {
+    return result.success ? "" : result.output;
+}
+
+}  // namespace
+
+uint64_t StableHash(const std::string& str) {
+    uint64_t hash = 0xcbf29ce484222325;
+    for (char c : str) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001b3;
+    }
+    return hash;
+}
+
+std::string CacheKey(const CompileRequest& req) {
+    std::stringstream ss;
+    ss << static_cast<uint32_t>(req.language) << ":" << req.version_major << "."
+       << req.version_minor << "\n"
+       << req.source;
+    return ss.str();
+}
+
+void ServerStats::AddLatency(uint64_t us) {
+    total_latency_us += us;
+    uint64_t max = max_latency_us;
+    while (us > max && !max_latency_us.compare_exchange_weak(max, us)) {
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ResultCache
+////////////////////////////////////////////////////////////////////////////////
+
+ResultCache::ResultCache(size_t max_memory_entries, std::string dir, size_t max_disk_entries)
+    : max_memory_entries_(max_memory_entries),
+      dir_(std::move(dir)),
+      max_disk_entries_(std::max<size_t>(max_disk_entries, 1)) {
+    if (!dir_.empty()) {
+        std::error_code err;
+        std::filesystem::create_directories(dir_, err);
+        disk_entries_ = DiskFiles().size();
+    }
+}
+
+std::optional<ResultCache::Hit> ResultCache::Get(const std::string& key) {
+    uint64_t hash = StableHash(key);
+    {
+        std::lock_guard<std::mutex> lock(memory_mutex_);
+        if (auto it = memory_index_.find(hash);
+            it != memory_index_.end() && it->second->key == key) {
+            // Move the entry to the front of the list, as it is now the most recently used.
+            memory_.splice(memory_.begin(), memory_, it->second);
+            return Hit{it->second->result, /* from_disk */ false};
+        }
+    }
+    if (auto result = LoadFromDisk(hash, key)) {
+        AddToMemory(hash, key, *result);
+        return Hit{*result, /* from_disk */ true};
+    }
+    return std::nullopt;
+}
+
+void ResultCache::Put(const std::string& key, const CompileResult& result) {
+    uint64_t hash = StableHash(key);
+    AddToMemory(hash, key, result);
+    StoreToDisk(hash, key, result);
+}
+
+void ResultCache::AddToMemory(uint64_t hash, const std::string& key, const CompileResult& result) {
+    if (max_memory_entries_ == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(memory_mutex_);
+    if (auto it = memory_index_.find(hash); it != memory_index_.end()) {
+        // Replace the existing entry, which may be for a different key with the same hash.
+        memory_.erase(it->second);
+        memory_index_.erase(it);
+    }
+    memory_.push_front(Entry{hash, key, result});
+    memory_index_[hash] = memory_.begin();
+    if (memory_.size() > max_memory_entries_) {
+        memory_index_.erase(memory_.back().hash);
+        memory_.pop_back();
+    }
+}
+
+std::filesystem::path ResultCache::DiskPath(uint64_t hash) const {
+    std::stringstream ss;
+    ss << std::hex;
+    ss.width(16);
+    ss.fill('0');
+    ss << hash;
+    return std::filesystem::path(dir_) / (ss.str() + ".bin");
+}
+
+std::vector<std::filesystem::path> ResultCache::DiskFiles() const {
+    std::vector<std::filesystem::path> files;
+    std::error_code err;
+    for (auto& entry : std::filesystem::directory_iterator(dir_, err)) {
+        if (entry.path().extension() == ".bin") {
+            files.push_back(entry.path());
+        }
+    }
+    return files;
+}
+
+std::optional<CompileResult> ResultCache::LoadFromDisk(uint64_t hash, const std::string& key) {
+    if (dir_.empty()) {
+        return std::nullopt;
+    }
+    auto path = DiskPath(hash);
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return std::nullopt;
+    }
+    auto read_string = [&](std::string& str) {
+        uint32_t size = 0;
+        file.read(reinterpret_cast<char*>(&size), sizeof(size));
+        if (file) {
+            str.resize(size);
+            file.read(str.data(), size);
+        }
+    };
+    std::string file_key;
+    read_string(file_key);
+    if (!file || file_key != key) {
+        return std::nullopt;  // Hash collision or truncated file
+    }
+    CompileResult result;
+    uint8_t success = 0;
+    file.read(reinterpret_cast<char*>(&success), sizeof(success));
+    read_string(result.output);
+    if (!file) {
+        return std::nullopt;
+    }
+    result.success = success != 0;
+
+    // Mark the file as the most recently used.
+    std::error_code err;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), err);
+    return result;
+}
+
+void ResultCache::StoreToDisk(uint64_t hash, const std::string& key, const CompileResult& result) {
+    if (dir_.empty()) {
+        return;
+    }
+    auto path = DiskPath(hash);
+
+    // Write to a temporary file, then rename it, so that a concurrent LoadFromDisk() never sees a
+    // partially written file.
+    auto tmp_path = path;
+    tmp_path += ".tmp" + std::to_string(next_tmp_id_++);
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        auto write_string = [&](const std::string& str) {
+            uint32_t size = static_cast<uint32_t>(str.size());
+            file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+            file.write(str.data(), size);
+        };
+        write_string(key);
+        uint8_t success = result.success ? 1 : 0;
+        file.write(reinterpret_cast<const char*>(&success), sizeof(success));
+        write_string(result.output);
+        if (!file) {
+            file.close();
+            std::error_code err;
+            std::filesystem::remove(tmp_path, err);
+            return;
+        }
+    }
+    std::error_code err;
+    // Replacing the result of an existing file, such as one that was stored by another thread, or
+    // one with a colliding hash, does not change the number of results held on disk.
+    bool replaced = std::filesystem::exists(path, err);
+    std::filesystem::rename(tmp_path, path, err);
+    if (err) {
+        std::filesystem::remove(tmp_path, err);
+        return;
+    }
+
+    if (!replaced && ++disk_entries_ > max_disk_entries_) {
+        EvictFromDisk();
+    }
+}
+
+void ResultCache::EvictFromDisk() {
+    std::lock_guard<std::mutex> lock(disk_mutex_);
+    auto files = DiskFiles();
+    size_t target = max_disk_entries_ - max_disk_entries_ / 10;
+    if (files.size() > target) {
+        using Time = std::filesystem::file_time_type;
+        std::vector<std::pair<Time, std::filesystem::path>> by_time;
+        by_time.reserve(files.size());
+        for (auto& file : files) {
+            std::error_code err;
+            by_time.emplace_back(std::filesystem::last_write_time(file, err), file);
+        }
+        std::sort(by_time.begin(), by_time.end());
+        size_t count = files.size() - target;
+        for (size_t i = 0; i < count; i++) {
+            std::error_code err;
+            std::filesystem::remove(by_time[i].second, err);
+        }
+        files.resize(target);
+    }
+    disk_entries_ = files.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// CompilePool
+////////////////////////////////////////////////////////////////////////////////
+
+CompilePool::CompilePool(size_t num_workers, CompileFn compile, ServerStats& stats)
+    : compile_(std::move(compile)), stats_(stats) {
+    for (size_t i = 0; i < num_workers; i++) {
+        workers_.emplace_back([this] { Run(); });
+    }
+}
+
+CompilePool::~CompilePool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+std::future<CompileResult> CompilePool::Enqueue(CompileRequest req) {
+    std::packaged_task<CompileResult()> task(
+        [this, req = std::move(req)] { return compile_(req); });
+    auto future = task.get_future();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(task));
+        stats_.queue_depth++;
+    }
+    cv_.notify_one();
+    return future;
+}
+
+void CompilePool::Run() {
+    while (true) {
+        std::packaged_task<CompileResult()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+            stats_.queue_depth--;
+        }
+        task();
+        stats_.compiles++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Server
+////////////////////////////////////////////////////////////////////////////////
+
+Server::Server(const ServerOptions& options)
+    : verbose_(options.verbose),
+      can_compile_(options.compile != nullptr),
+      cache_(options.memory_cache_entries, options.cache_dir, options.disk_cache_entries),
+      pool_(options.jobs > 0 ? options.jobs
+                             : std::max<size_t>(std::thread::hardware_concurrency(), 1),
+            options.compile,
+            stats_) {}
+
+void Server::Serve(tint::socket::Socket* conn) {
+    auto tid = std::this_thread::get_id();
+    if (verbose_) {
+        std::cout << tid << " Client connected...\n";
+    }
+    Stream stream{conn, ""};
+
+    {
+        ConnectionRequest req;
+        stream >> req;
+        if (!stream.error.empty()) {
+            if (verbose_) {
+                std::cout << tid << " Error: " << stream.error << "\n";
+            }
+            return;
+        }
+        ConnectionResponse resp;
+        if (req.protocol_version != kProtocolVersion) {
+            if (verbose_) {
+                std::cout << tid << " Protocol version mismatch. requested: "
+                          << req.protocol_version << "\n";
+            }
+            resp.error = "Protocol version mismatch";
+            stream << resp;
+            return;
+        }
+        stream << resp;
+    }
+    if (verbose_) {
+        std::cout << tid << " Connection established\n";
+    }
+
+    // Serve requests until the client disconnects.
+    while (true) {
+        Message::Type type;
+        stream >> type;
+        if (!stream.error.empty()) {
+            break;
+        }
+        switch (type) {
+            case Message::Type::CompileRequest: {
+                std::vector<CompileRequest> shaders(1);
+                ReadBody(stream, shaders[0]);
+                if (!stream.error.empty()) {
+                    break;
+                }
+                stats_.requests++;
+                auto results = CompileAll(shaders);
+                stream << results[0];
+                if (verbose_) {
+                    std::cout << tid << " Shader compilation "
+                              << (results[0].error.empty() ? "passed" : "failed") << "\n";
+                }
+                break;
+            }
+            case Message::Type::BatchCompileRequest: {
+                BatchCompileRequest req;
+                ReadBody(stream, req);
+                if (!stream.error.empty()) {
+                    break;
+                }
+                stats_.requests++;
+                BatchCompileResponse resp;
+                resp.results = CompileAll(req.shaders);
+                stream << resp;
+                if (verbose_) {
+                    std::cout << tid << " Batch of " << req.shaders.size()
+                              << " shaders compiled\n";
+                }
+                break;
+            }
+            case Message::Type::StatsRequest: {
+                StatsRequest req;
+                ReadBody(stream, req);
+                if (!stream.error.empty()) {
+                    break;
+                }
+                stream << Stats();
+                break;
+            }
+            default:
+                stream.error =
+                    "Unexpected message type " + std::to_string(static_cast<int>(type));
+                break;
+        }
+        if (!stream.error.empty()) {
+            if (verbose_) {
+                std::cout << tid << " Error: " << stream.error << "\n";
+            }
+            break;
+        }
+    }
+    if (verbose_) {
+        std::cout << tid << " Client disconnected\n";
+    }
+}
+
+std::vector<CompileResponse> Server::CompileAll(const std::vector<CompileRequest>& shaders) {
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    auto done = [&] {
+        auto elapsed = Clock::now() - start;
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        stats_.AddLatency(static_cast<uint64_t>(us));
+    };
+
+    std::vector<CompileResponse> responses(shaders.size());
+    std::vector<std::string> keys(shaders.size());
+    std::vector<std::pair<size_t, std::future<CompileResult>>> pending;
+    for (size_t i = 0; i < shaders.size(); i++) {
+        stats_.shaders++;
+        if (!can_compile_) {
+            responses[i].error = kCannotCompile;
+            done();
+            continue;
+        }
+        keys[i] = CacheKey(shaders[i]);
+        if (auto hit = cache_.Get(keys[i])) {
+            (hit->from_disk ? stats_.disk_cache_hits : stats_.memory_cache_hits)++;
+            responses[i].error = ErrorOf(hit->result);
+            done();
+            continue;
+        }
+        stats_.cache_misses++;
+        pending.emplace_back(i, pool_.Enqueue(shaders[i]));
+    }
+    for (auto& [i, future] : pending) {
+        auto result = future.get();
+        cache_.Put(keys[i], result);
+        responses[i].error = ErrorOf(result);
+        done();
+    }
+    return responses;
+}
+
+StatsResponse Server::Stats() const {
+    StatsResponse resp;
+    resp.workers = pool_.NumWorkers();
+    resp.queue_depth = stats_.queue_depth;
+    resp.requests = stats_.requests;
+    resp.shaders = stats_.shaders;
+    resp.compiles = stats_.compiles;
+    resp.memory_cache_hits = stats_.memory_cache_hits;
+    resp.disk_cache_hits = stats_.disk_cache_hits;
+    resp.cache_misses = stats_.cache_misses;
+    resp.total_latency_us = stats_.total_latency_us;
+    resp.max_latency_us = stats_.max_latency_us;
+    return resp;
+}
+
+}  // namespace tint::remote_compile
@@ -0,0 +1,273 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_CMD_REMOTE_COMPILE_SERVER_SERVER_H_
+#define SRC_TINT_CMD_REMOTE_COMPILE_SERVER_SERVER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "src/tint/cmd/remote_compile/server/protocol.h"
+
+namespace tint::remote_compile {
+
+/// The error returned for shaders that the server cannot compile
+constexpr const char* kCannotCompile = "server cannot compile this type of shader";
+
+/// A function that compiles the shader of a compile request. Called concurrently from the compiler
+/// threads of the server.
+using CompileFn = std::function<CompileResult(const CompileRequest&)>;
+
+/// @returns the 64-bit FNV-1a hash of `str`. Unlike std::hash, the hash is stable between runs of
+/// the server, so it can be used to name the files of the on-disk cache.
+uint64_t StableHash(const std::string& str);
+
+/// @returns the key used to cache the result of the compile request `req`. The key holds the
+/// compile options and the full shader source, so that cache hits can be verified.
+std::string CacheKey(const CompileRequest& req);
+
+/// Counters exported by the server with a StatsResponse
+struct ServerStats {
+    /// Adds the time taken to serve a single shader
+    /// @param us the time in microseconds
+    void AddLatency(uint64_t us);
+
+    /// @see StatsResponse
+    std::atomic<uint64_t> queue_depth{0};
+    /// @see StatsResponse
+    std::atomic<uint64_t> requests{0};
+    /// @see StatsResponse
+    std::atomic<uint64_t> shaders{0};
+    /// @see StatsResponse
+    std::atomic<uint64_t> compiles{0};
+    /// @see StatsResponse
+    std::atomic<uint64_t> memory_cache_hits{0};
+    /// @see StatsResponse
+    std::atomic<uint64_t> disk_cache_hits{0};
+    /// @see StatsResponse
+    std::atomic<uint64_t> cache_misses{0};
+    /// @see StatsResponse
+    std::atomic<uint64_t> total_latency_us{0};
+    /// @see StatsResponse
+    std::atomic<uint64_t> max_latency_us{0};
+};
+
+/// ResultCache is a thread-safe, least-recently-used cache of compilation results. Results are
+/// held in memory, and optionally in a directory on disk so that they persist between runs of the
+/// server. Each on-disk result is a single file, and the recency of the file is its modification
+/// time.
+class ResultCache {
+  public:
+    /// A result found in the cache
+    struct Hit {
+        /// The cached compilation result
+        CompileResult result;
+        /// True if the result was loaded from the on-disk cache
+        bool from_disk = false;
+    };
+
+    /// Constructor
+    /// @param max_memory_entries the maximum number of results held in memory
+    /// @param dir the directory of the on-disk cache. If empty, results are not held on disk.
+    /// @param max_disk_entries the maximum number of results held on disk
+    ResultCache(size_t max_memory_entries, std::string dir, size_t max_disk_entries);
+
+    /// @param key the cache key, as returned by CacheKey()
+    /// @returns the cached result for `key`, or std::nullopt if the result is not cached
+    std::optional<Hit> Get(const std::string& key);
+
+    /// Adds a result to the cache
+    /// @param key the cache key, as returned by CacheKey()
+    /// @param result the compilation result
+    void Put(const std::string& key, const CompileResult& result);
+
+    /// @returns the approximate number of results held on disk
+    size_t DiskEntries() const { return disk_entries_; }
+
+  private:
+    /// An entry of the in-memory cache
+    struct Entry {
+        /// The StableHash() of the key
+        uint64_t hash = 0;
+        /// The cache key
+        std::string key;
+        /// The compilation result
+        CompileResult result;
+    };
+
+    /// Adds the result to the in-memory cache, evicting the least recently used entry if the cache
+    /// is full.
+    void AddToMemory(uint64_t hash, const std::string& key, const CompileResult& result);
+
+    /// @returns the path of the on-disk cache file for the key with the hash `hash`
+    std::filesystem::path DiskPath(uint64_t hash) const;
+
+    /// @returns the paths of all the result files of the on-disk cache
+    std::vector<std::filesystem::path> DiskFiles() const;
+
+    /// @returns the result for `key` loaded from the on-disk cache, or std::nullopt if the result
+    /// is not in the on-disk cache
+    std::optional<CompileResult> LoadFromDisk(uint64_t hash, const std::string& key);
+
+    /// Stores the result for `key` to the on-disk cache, evicting the least recently used results
+    /// if the cache is full.
+    void StoreToDisk(uint64_t hash, const std::string& key, const CompileResult& result);
+
+    /// Removes the least recently used results from the on-disk cache, until the cache is 90% of
+    /// its maximum size. Evicting more than a single file amortizes the cost of scanning the
+    /// directory.
+    void EvictFromDisk();
+
+    /// The maximum number of results held in memory
+    const size_t max_memory_entries_;
+    /// The directory of the on-disk cache
+    const std::string dir_;
+    /// The maximum number of results held on disk
+    const size_t max_disk_entries_;
+
+    /// Mutex guarding memory_ and memory_index_
+    std::mutex memory_mutex_;
+    /// The in-memory results, ordered from the most recently used to the least recently used
+    std::list<Entry> memory_;
+    /// A map of key hash to entry of memory_
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> memory_index_;
+
+    /// Mutex guarding the eviction of on-disk results
+    std::mutex disk_mutex_;
+    /// The approximate number of results held on disk
+    std::atomic<size_t> disk_entries_{0};
+    /// The identifier of the next temporary file
+    std::atomic<uint64_t> next_tmp_id_{0};
+};
+
+/// CompilePool is a fixed size pool of threads that compile shaders in the order they were queued.
+class CompilePool {
+  public:
+    /// Constructor
+    /// @param num_workers the number of compiler threads
+    /// @param compile the function used to compile each shader
+    /// @param stats the server counters. queue_depth and compiles are updated by the pool.
+    CompilePool(size_t num_workers, CompileFn compile, ServerStats& stats);
+
+    /// Destructor. Waits for all the queued shaders to be compiled.
+    ~CompilePool();
+
+    /// Queues the shader of `req` for compilation
+    /// @param req the compile request
+    /// @returns a future that holds the result of the compilation
+    std::future<CompileResult> Enqueue(CompileRequest req);
+
+    /// @returns the number of compiler threads
+    size_t NumWorkers() const { return workers_.size(); }
+
+  private:
+    /// The body of each of the compiler threads
+    void Run();
+
+    /// The function used to compile each shader
+    const CompileFn compile_;
+    /// The server counters
+    ServerStats& stats_;
+    /// Mutex guarding queue_ and stopping_
+    std::mutex mutex_;
+    /// Condition variable signalled when a task is queued, or the pool is stopping
+    std::condition_variable cv_;
+    /// The queue of shaders waiting to be compiled
+    std::deque<std::packaged_task<CompileResult()>> queue_;
+    /// True when the pool is being destructed
+    bool stopping_ = false;
+    /// The compiler threads
+    std::vector<std::thread> workers_;
+};
+
+/// Options for the server
+struct ServerOptions {
+    /// The port to listen on
+    std::string port;
+    /// Print progress to stdout
+    bool verbose = false;
+    /// The number of compiler threads. If 0, then the number of cores is used.
+    size_t jobs = 0;
+    /// The maximum number of results held in the in-memory cache
+    size_t memory_cache_entries = 1024;
+    /// The directory of the on-disk cache. If empty, results are not cached on disk.
+    std::string cache_dir;
+    /// The maximum number of results held in the on-disk cache
+    size_t disk_cache_entries = 65536;
+    /// The function used to compile each shader. If null, every shader is answered with
+    /// kCannotCompile.
+    CompileFn compile;
+};
+
+/// Server serves the connections of the clients
+class Server {
+  public:
+    /// Constructor
+    /// @param options the server options
+    explicit Server(const ServerOptions& options);
+
+    /// Serves the requests of a single client connection, until the client disconnects.
+    /// @param conn the client connection
+    void Serve(tint::socket::Socket* conn);
+
+    /// @returns a StatsResponse holding the current server counters
+    StatsResponse Stats() const;
+
+  private:
+    /// Compiles each of the shaders, using the cached result where possible.
+    /// @param shaders the shaders to compile
+    /// @returns the response for each of the shaders
+    std::vector<CompileResponse> CompileAll(const std::vector<CompileRequest>& shaders);
+
+    /// Print progress to stdout
+    const bool verbose_;
+    /// True if the server has a compile function
+    const bool can_compile_;
+    /// The server counters
+    ServerStats stats_;
+    /// The compilation result cache
+    ResultCache cache_;
+    /// The compiler threads. Declared last so that the threads are joined before the other members
+    /// are destructed.
+    CompilePool pool_;
+};
+
+}  // namespace tint::remote_compile
+
+#endif  // SRC_TINT_CMD_REMOTE_COMPILE_SERVER_SERVER_H_
@@ -0,0 +1,336 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/cmd/remote_compile/server/server.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tint::remote_compile {
+namespace {
+
+/// A compile function that fails shaders that contain the word 'error', and counts the number of
+/// compilations.
+struct FakeCompiler {
+    CompileResult operator()(const CompileRequest& req) {
+        count++;
+        if (req.source.find("error") != std::string::npos) {
+            return CompileResult{false, "error: " + req.source};
+        }
+        return CompileResult{true, ""};
+    }
+
+    std::atomic<int> count{0};
+};
+
+class RemoteCompileServerTest : public testing::Test {
+  protected:
+    void TearDown() override { StopServer(); }
+
+    /// Starts a server listening on a free localhost port.
+    void StartServer(ServerOptions options) {
+        if (!options.compile && use_fake_compiler) {
+            options.compile = [this](const CompileRequest& req) { return compiler(req); };
+        }
+        server = std::make_unique<Server>(options);
+        for (int p = 19200; p < 19300 && !listener; p++) {
+            port = std::to_string(p);
+            listener = tint::socket::Socket::Listen("127.0.0.1", port.c_str());
+        }
+        ASSERT_NE(listener, nullptr);
+        accept_thread = std::thread([this] {
+            while (auto conn = listener->Accept()) {
+                std::lock_guard<std::mutex> lock(mutex);
+                connection_threads.emplace_back([this, conn] { server->Serve(conn.get()); });
+            }
+        });
+    }
+
+    /// Stops the server, once all the client connections have been closed.
+    void StopServer() {
+        if (!listener) {
+            return;
+        }
+        listener->Close();
+        accept_thread.join();
+        for (auto& thread : connection_threads) {
+            thread.join();
+        }
+        connection_threads.clear();
+        listener.reset();
+        server.reset();
+    }
+
+    /// @returns a new connection to the server, after the connection handshake
+    std::shared_ptr<tint::socket::Socket> Connect() {
+        auto conn = tint::socket::Socket::Connect("127.0.0.1", port.c_str(), 10'000);
+        EXPECT_NE(conn, nullptr);
+        if (conn) {
+            Stream stream{conn.get(), ""};
+            auto resp = Send(stream, ConnectionRequest{});
+            EXPECT_EQ(stream.error, "");
+            EXPECT_EQ(resp.error, "");
+        }
+        return conn;
+    }
+
+    /// @returns the server counters, queried with a StatsRequest
+    StatsResponse QueryStats() {
+        auto conn = Connect();
+        Stream stream{conn.get(), ""};
+        auto resp = Send(stream, StatsRequest{});
+        EXPECT_EQ(stream.error, "");
+        return resp;
+    }
+
+    static CompileRequest Shader(std::string source) {
+        return CompileRequest{SourceLanguage::MSL, 2, 1, std::move(source)};
+    }
+
+    FakeCompiler compiler;
+    bool use_fake_compiler = true;
+    std::string port;
+    std::unique_ptr<Server> server;
+    std::shared_ptr<tint::socket::Socket> listener;
+    std::thread accept_thread;
+    std::mutex mutex;
+    std::vector<std::thread> connection_threads;
+};
+
+/// A directory for the on-disk cache, removed when the test ends.
+struct TempDir {
+    TempDir() {
+        auto ticks = std::chrono::steady_clock::now().time_since_epoch().count();
+        path = (std::filesystem::temp_directory_path() /
+                ("tint_remote_compile_test_" + std::to_string(ticks)))
+                   .string();
+    }
+    ~TempDir() {
+        std::error_code err;
+        std::filesystem::remove_all(path, err);
+    }
+    std::string path;
+};
+
+TEST_F(RemoteCompileServerTest, CannotCompileWithoutCompileFunction) {
+    use_fake_compiler = false;
+    StartServer({});
+    auto conn = Connect();
+    Stream stream{conn.get(), ""};
+    auto resp = Send(stream, Shader("kernel void f() {}"));
+    EXPECT_EQ(stream.error, "");
+    EXPECT_EQ(resp.error, kCannotCompile);
+}
+
+TEST_F(RemoteCompileServerTest, ProtocolVersionMismatch) {
+    StartServer({});
+    auto conn = tint::socket::Socket::Connect("127.0.0.1", port.c_str(), 10'000);
+    ASSERT_NE(conn, nullptr);
+    Stream stream{conn.get(), ""};
+    auto resp = Send(stream, ConnectionRequest{kProtocolVersion + 1});
+    EXPECT_EQ(stream.error, "");
+    EXPECT_EQ(resp.error, "Protocol version mismatch");
+}
+
+TEST_F(RemoteCompileServerTest, CompileAndMemoryCacheHit) {
+    StartServer({});
+    {
+        auto conn = Connect();
+        Stream stream{conn.get(), ""};
+        EXPECT_EQ(Send(stream, Shader("kernel void f() {}")).error, "");
+        EXPECT_EQ(Send(stream, Shader("kernel void f() {}")).error, "");
+        EXPECT_EQ(stream.error, "");
+    }
+    EXPECT_EQ(compiler.count.load(), 1);
+
+    auto stats = QueryStats();
+    EXPECT_EQ(stats.requests, 2u);
+    EXPECT_EQ(stats.shaders, 2u);
+    EXPECT_EQ(stats.compiles, 1u);
+    EXPECT_EQ(stats.memory_cache_hits, 1u);
+    EXPECT_EQ(stats.disk_cache_hits, 0u);
+    EXPECT_EQ(stats.cache_misses, 1u);
+}
+
+TEST_F(RemoteCompileServerTest, CompileErrorIsCached) {
+    StartServer({});
+    auto conn = Connect();
+    Stream stream{conn.get(), ""};
+    EXPECT_EQ(Send(stream, Shader("error")).error, "error: error");
+    EXPECT_EQ(Send(stream, Shader("error")).error, "error: error");
+    EXPECT_EQ(stream.error, "");
+    EXPECT_EQ(compiler.count.load(), 1);
+}
+
+TEST_F(RemoteCompileServerTest, CacheKeyIncludesVersion) {
+    StartServer({});
+    auto conn = Connect();
+    Stream stream{conn.get(), ""};
+    EXPECT_EQ(Send(stream, CompileRequest{SourceLanguage::MSL, 2, 1, "src"}).error, "");
+    EXPECT_EQ(Send(stream, CompileRequest{SourceLanguage::MSL, 2, 3, "src"}).error, "");
+    EXPECT_EQ(stream.error, "");
+    EXPECT_EQ(compiler.count.load(), 2);
+}
+
+TEST_F(RemoteCompileServerTest, BatchCompileUsesAllWorkers) {
+    constexpr int kWorkers = 3;
+
+    // The first kWorkers compilations wait until they are all running at the same time, which can
+    // only happen if the pool compiles the batch on kWorkers threads.
+    std::mutex compile_mutex;
+    std::condition_variable compile_cv;
+    int started = 0;
+    int active = 0;
+    int max_active = 0;
+    bool all_workers_ran = false;
+    ServerOptions options;
+    options.jobs = kWorkers;
+    options.compile = [&](const CompileRequest& req) {
+        {
+            std::unique_lock<std::mutex> lock(compile_mutex);
+            active++;
+            max_active = std::max(max_active, active);
+            if (++started <= kWorkers) {
+                compile_cv.notify_all();
+                if (compile_cv.wait_for(lock, std::chrono::seconds(10),
+                                        [&] { return started >= kWorkers; })) {
+                    all_workers_ran = true;
+                }
+            }
+            active--;
+        }
+        return compiler(req);
+    };
+    StartServer(options);
+
+    BatchCompileRequest batch;
+    for (int i = 0; i < 6; i++) {
+        batch.shaders.push_back(Shader(i == 4 ? "error " + std::to_string(i) : std::to_string(i)));
+    }
+    {
+        auto conn = Connect();
+        Stream stream{conn.get(), ""};
+        auto resp = Send(stream, batch);
+        EXPECT_EQ(stream.error, "");
+        ASSERT_EQ(resp.results.size(), 6u);
+        for (int i = 0; i < 6; i++) {
+            EXPECT_EQ(resp.results[i].error, i == 4 ? "error: error 4" : "") << "shader " << i;
+        }
+    }
+    EXPECT_TRUE(all_workers_ran);
+    EXPECT_EQ(max_active, kWorkers);
+    EXPECT_EQ(compiler.count.load(), 6);
+
+    auto stats = QueryStats();
+    EXPECT_EQ(stats.workers, static_cast<uint64_t>(kWorkers));
+    EXPECT_EQ(stats.requests, 1u);
+    EXPECT_EQ(stats.shaders, 6u);
+    EXPECT_EQ(stats.compiles, 6u);
+    EXPECT_EQ(stats.queue_depth, 0u);
+    EXPECT_EQ(stats.cache_misses, 6u);
+}
+
+TEST_F(RemoteCompileServerTest, DiskCachePersistsBetweenServers) {
+    TempDir dir;
+    ServerOptions options;
+    options.cache_dir = dir.path;
+
+    StartServer(options);
+    {
+        auto conn = Connect();
+        Stream stream{conn.get(), ""};
+        EXPECT_EQ(Send(stream, Shader("a")).error, "");
+        EXPECT_EQ(Send(stream, Shader("error b")).error, "error: error b");
+    }
+    EXPECT_EQ(compiler.count.load(), 2);
+    StopServer();
+
+    StartServer(options);
+    {
+        auto conn = Connect();
+        Stream stream{conn.get(), ""};
+        EXPECT_EQ(Send(stream, Shader("a")).error, "");
+        EXPECT_EQ(Send(stream, Shader("error b")).error, "error: error b");
+        EXPECT_EQ(Send(stream, Shader("a")).error, "");
+    }
+    EXPECT_EQ(compiler.count.load(), 2);
+
+    auto stats = QueryStats();
+    EXPECT_EQ(stats.disk_cache_hits, 2u);
+    EXPECT_EQ(stats.memory_cache_hits, 1u);
+    EXPECT_EQ(stats.cache_misses, 0u);
+}
+
+TEST(RemoteCompileResultCacheTest, DiskEntriesCountsFiles) {
+    TempDir dir;
+    {
+        ResultCache cache(0, dir.path, 100);
+        for (int i = 0; i < 3; i++) {
+            cache.Put("a", CompileResult{true, ""});
+        }
+        EXPECT_EQ(cache.DiskEntries(), 1u);
+        cache.Put("b", CompileResult{false, "b"});
+        EXPECT_EQ(cache.DiskEntries(), 2u);
+    }
+    ResultCache cache(0, dir.path, 100);
+    EXPECT_EQ(cache.DiskEntries(), 2u);
+    auto hit = cache.Get("b");
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_TRUE(hit->from_disk);
+    EXPECT_FALSE(hit->result.success);
+    EXPECT_EQ(hit->result.output, "b");
+}
+
+TEST(RemoteCompileResultCacheTest, DiskEviction) {
+    TempDir dir;
+    ResultCache cache(0, dir.path, 10);
+    for (int i = 0; i < 10; i++) {
+        cache.Put(std::to_string(i), CompileResult{true, ""});
+    }
+    EXPECT_EQ(cache.DiskEntries(), 10u);
+
+    // Overwriting an existing result does not evict.
+    cache.Put("0", CompileResult{true, ""});
+    EXPECT_EQ(cache.DiskEntries(), 10u);
+
+    // Exceeding the limit evicts down to 90% of the limit.
+    cache.Put("10", CompileResult{true, ""});
+    EXPECT_EQ(cache.DiskEntries(), 9u);
+}
+
+}  // namespace
+}  // namespace tint::remote_compile
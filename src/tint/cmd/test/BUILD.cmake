@@ -47,6 +47,7 @@ tint_target_add_dependencies(tint_cmd_test_test_cmd test_cmd
   tint_api_common_test
   tint_api_options_test
   tint_cmd_common_test
+  tint_cmd_remote_compile_server_test
   tint_lang_core_constant_test
   tint_lang_core_intrinsic_test
   tint_lang_core_ir_transform_test
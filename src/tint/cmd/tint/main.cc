@@ -25,13 +25,19 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <charconv>
+#include <chrono>
 #include <cstdio>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <optional>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include "src/tint/lang/wgsl/sem/variable.h"
 
@@ -39,10 +45,12 @@
 #include "spirv-tools/libspirv.hpp"
 #endif  // TINT_BUILD_SPV_READER || TINT_BUILD_SPV_WRITER
 
+#include "src/tint/api/options/ir_passes.h"
 #include "src/tint/api/options/pixel_local.h"
 #include "src/tint/api/tint.h"
 #include "src/tint/cmd/common/generate_external_texture_bindings.h"
 #include "src/tint/cmd/common/helper.h"
+#include "src/tint/cmd/common/split_entry_points.h"
 #include "src/tint/lang/core/ir/disassembler.h"
 #include "src/tint/lang/core/ir/module.h"
 #include "src/tint/lang/wgsl/ast/module.h"
@@ -132,8 +140,26 @@
 namespace {
 
 /// Prints the given hash value in a format string that the end-to-end test runner can parse.
-[[maybe_unused]] void PrintHash(uint32_t hash) {
-    std::cout << "<<HASH: 0x" << std::hex << hash << ">>\n";
+/// @param out the stream to print the hash to
+/// @param hash the hash value
+[[maybe_unused]] void PrintHash(std::ostream& out, uint32_t hash) {
+    out << "<<HASH: 0x" << std::hex << hash << ">>\n";
+}
+
+/// Prints the time taken and the resulting instruction count of each IR pass.
+/// @param out the stream to print the statistics to
+/// @param stats the per-pass statistics reported by the writer
+[[maybe_unused]] void PrintIRPassStats(std::ostream& out,
+                                       const std::vector<tint::IRPassStats>& stats) {
+    std::chrono::nanoseconds total{};
+    for (auto& pass : stats) {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(pass.duration);
+        out << pass.name << ": " << us.count() << "us, " << pass.num_instructions
+            << " instructions\n";
+        total += pass.duration;
+    }
+    out << "total: " << std::chrono::duration_cast<std::chrono::microseconds>(total).count()
+        << "us\n";
 }
 
 enum class Format : uint8_t {
@@ -160,7 +186,7 @@ enum class ColorMode { kPlain, kDark, kLight };
 struct Options {
     bool verbose = false;
 
-    std::unique_ptr<tint::StyledTextPrinter> printer;
+    std::shared_ptr<tint::StyledTextPrinter> printer;
 
     std::string input_filename;
     std::string output_file = "-";  // Default to stdout
@@ -179,6 +205,14 @@ struct Options {
     bool emit_single_entry_point = false;
     std::string ep_name;
 
+    bool split_entry_points = false;
+    uint32_t jobs = 0;
+
+    /// If not null, text that would be written to standard output is appended to this stream.
+    std::ostream* stdout_capture = nullptr;
+    /// If not null, text that would be written to standard error is appended to this stream.
+    std::ostream* stderr_capture = nullptr;
+
     bool rename_all = false;
 
 #if TINT_BUILD_SPV_READER
@@ -211,6 +245,7 @@ struct Options {
     bool dump_ir = false;
     bool use_ir = false;
     bool use_ir_reader = false;
+    tint::IRPassOptions ir_passes;
 
 #if TINT_BUILD_SYNTAX_TREE_WRITER
     bool dump_ast = false;
@@ -327,6 +362,20 @@ If not provided, will be inferred from output filename extension:
         }
     });
 
+    auto& split_entry_points = options.Add<BoolOption>(
+        "split-entry-points",
+        R"(Generate a separate output for each entry point.
+When writing to a file, the entry point name is inserted
+before the output file extension)",
+        Default{false});
+    TINT_DEFER(opts->split_entry_points = *split_entry_points.value);
+
+    auto& jobs = options.Add<ValueOption<uint32_t>>(
+        "jobs", R"(Number of threads used by --split-entry-points.
+0 uses the number of hardware threads)",
+        ShortName{"j"}, Default{0});
+    TINT_DEFER(opts->jobs = *jobs.value);
+
     auto& output = options.Add<StringOption>("output-name", "Output file name", ShortName{"o"},
                                              Parameter{"name"});
     TINT_DEFER(opts->output_file = output.value.value_or(""));
@@ -370,6 +419,20 @@ When specified, automatically enables MSL validation)",
         "use-ir-reader", "Use the IR for the SPIR-V reader", Default{false});
     TINT_DEFER(opts->use_ir_reader = *use_ir_reader.value);
 
+    auto& ir_pass_validation = options.Add<EnumOption<tint::IRPassValidation>>(
+        "ir-pass-validation", "When to validate the IR between the writer's IR passes",
+        tint::Vector{
+            EnumName{tint::IRPassValidation::kNone, "none"},
+            EnumName{tint::IRPassValidation::kStartAndEnd, "start-end"},
+            EnumName{tint::IRPassValidation::kEachPass, "each-pass"},
+        },
+        Default{tint::IRPassValidation::kNone});
+    TINT_DEFER(opts->ir_passes.validation = *ir_pass_validation.value);
+
+    auto& ir_pass_stats = options.Add<BoolOption>(
+        "ir-pass-stats", "Print the time taken by each of the writer's IR passes", Default{false});
+    TINT_DEFER(opts->ir_passes.collect_stats = *ir_pass_stats.value);
+
     auto& verbose =
         options.Add<BoolOption>("verbose", "Verbose output", ShortName{"v"}, Default{false});
     TINT_DEFER(opts->verbose = *verbose.value);
@@ -661,7 +724,8 @@ Options:
 template <typename ContainerT>
 [[maybe_unused]] bool WriteFile(const std::string& output_file,
                                 const std::string mode,
-                                const ContainerT& buffer) {
+                                const ContainerT& buffer,
+                                std::ostream& err = std::cerr) {
     const bool use_stdout = output_file.empty() || output_file == "-";
     FILE* file = stdout;
 
@@ -672,7 +736,7 @@ template <typename ContainerT>
         file = fopen(output_file.c_str(), mode.c_str());
 #endif
         if (!file) {
-            std::cerr << "Could not open file " << output_file << " for writing\n";
+            err << "Could not open file " << output_file << " for writing\n";
             return false;
         }
     }
@@ -681,9 +745,9 @@ template <typename ContainerT>
         fwrite(buffer.data(), sizeof(typename ContainerT::value_type), buffer.size(), file);
     if (buffer.size() != written) {
         if (use_stdout) {
-            std::cerr << "Could not write all output to standard output\n";
+            err << "Could not write all output to standard output\n";
         } else {
-            std::cerr << "Could not write to file " << output_file << "\n";
+            err << "Could not write to file " << output_file << "\n";
             fclose(file);
         }
         return false;
@@ -695,8 +759,36 @@ template <typename ContainerT>
     return true;
 }
 
+/// @returns the stream that text for standard output should be written to
+[[maybe_unused]] std::ostream& StdOut(const Options& options) {
+    return options.stdout_capture ? *options.stdout_capture : std::cout;
+}
+
+/// @returns the stream that errors and other text for standard error should be written to
+[[maybe_unused]] std::ostream& StdErr(const Options& options) {
+    return options.stderr_capture ? *options.stderr_capture : std::cerr;
+}
+
+/// Writes the given `buffer` to the output file named by `options.output_file`, using WriteFile().
+/// If the output is standard output and `options.stdout_capture` is not null, then the buffer is
+/// appended to the capture stream instead.
+/// @returns true on success
+template <typename ContainerT>
+[[maybe_unused]] bool WriteOutput(const Options& options,
+                                  const std::string mode,
+                                  const ContainerT& buffer) {
+    const bool use_stdout = options.output_file.empty() || options.output_file == "-";
+    if (use_stdout && options.stdout_capture) {
+        options.stdout_capture->write(
+            reinterpret_cast<const char*>(buffer.data()),
+            static_cast<std::streamsize>(buffer.size() * sizeof(typename ContainerT::value_type)));
+        return true;
+    }
+    return WriteFile(options.output_file, mode, buffer, StdErr(options));
+}
+
 #if TINT_BUILD_SPV_WRITER
-std::string Disassemble(const std::vector<uint32_t>& data) {
+std::string Disassemble(const std::vector<uint32_t>& data, std::ostream& err) {
     std::string spv_errors;
     spv_target_env target_env = SPV_ENV_VULKAN_1_1;
 
@@ -729,7 +821,7 @@ std::string Disassemble(const std::vector<uint32_t>& data) {
     if (!tools.Disassemble(
             data, &result,
             SPV_BINARY_TO_TEXT_OPTION_INDENT | SPV_BINARY_TO_TEXT_OPTION_FRIENDLY_NAMES)) {
-        std::cerr << spv_errors << "\n";
+        err << spv_errors << "\n";
     }
     return result;
 }
@@ -747,13 +839,14 @@ bool GenerateSpirv(const tint::Program& program, const Options& options) {
     gen_options.disable_workgroup_init = options.disable_workgroup_init;
     gen_options.use_storage_input_output_16 = options.use_storage_input_output_16;
     gen_options.bindings = tint::spirv::writer::GenerateBindings(program);
+    gen_options.ir_passes = options.ir_passes;
 
     tint::Result<tint::spirv::writer::Output> result;
     if (options.use_ir) {
         // Convert the AST program to an IR module.
         auto ir = tint::wgsl::reader::ProgramToLoweredIR(program);
         if (ir != tint::Success) {
-            std::cerr << "Failed to generate IR: " << ir << "\n";
+            StdErr(options) << "Failed to generate IR: " << ir << "\n";
             return false;
         }
         result = tint::spirv::writer::Generate(ir.Get(), gen_options);
@@ -762,32 +855,37 @@ bool GenerateSpirv(const tint::Program& program, const Options& options) {
     }
 
     if (result != tint::Success) {
-        tint::cmd::PrintWGSL(std::cerr, program);
-        std::cerr << "Failed to generate: " << result.Failure() << "\n";
+        tint::cmd::PrintWGSL(StdErr(options), program);
+        StdErr(options) << "Failed to generate: " << result.Failure() << "\n";
         return false;
     }
 
+    if (options.ir_passes.collect_stats) {
+        PrintIRPassStats(StdErr(options), result->ir_pass_stats);
+    }
+
     if (options.format == Format::kSpvAsm) {
-        if (!WriteFile(options.output_file, "w", Disassemble(result.Get().spirv))) {
+        if (!WriteOutput(options, "w", Disassemble(result.Get().spirv, StdErr(options)))) {
             return false;
         }
     } else {
-        if (!WriteFile(options.output_file, "wb", result.Get().spirv)) {
+        if (!WriteOutput(options, "wb", result.Get().spirv)) {
             return false;
         }
     }
 
     const auto hash = tint::CRC32(result.Get().spirv.data(), result.Get().spirv.size());
     if (options.print_hash) {
-        PrintHash(hash);
+        PrintHash(StdOut(options), hash);
     }
 
     if (options.validate && options.skip_hash.count(hash) == 0) {
         // Use Vulkan 1.1, since this is what Tint, internally, uses.
         spvtools::SpirvTools tools(SPV_ENV_VULKAN_1_1);
+        auto& err = StdErr(options);
         tools.SetMessageConsumer(
-            [](spv_message_level_t, const char*, const spv_position_t& pos, const char* msg) {
-                std::cerr << (pos.line + 1) << ":" << (pos.column + 1) << ": " << msg << "\n";
+            [&err](spv_message_level_t, const char*, const spv_position_t& pos, const char* msg) {
+                err << (pos.line + 1) << ":" << (pos.column + 1) << ": " << msg << "\n";
             });
         if (!tools.Validate(result.Get().spirv.data(), result.Get().spirv.size(),
                             spvtools::ValidatorOptions())) {
@@ -799,7 +897,7 @@ bool GenerateSpirv(const tint::Program& program, const Options& options) {
 #else
     (void)program;
     (void)options;
-    std::cerr << "SPIR-V writer not enabled in tint build" << std::endl;
+    StdErr(options) << "SPIR-V writer not enabled in tint build" << std::endl;
     return false;
 #endif  // TINT_BUILD_SPV_WRITER
 }
@@ -815,17 +913,17 @@ bool GenerateWgsl([[maybe_unused]] const tint::Program& program,
     tint::wgsl::writer::Options gen_options;
     auto result = tint::wgsl::writer::Generate(program, gen_options);
     if (result != tint::Success) {
-        std::cerr << "Failed to generate: " << result.Failure() << "\n";
+        StdErr(options) << "Failed to generate: " << result.Failure() << "\n";
         return false;
     }
 
-    if (!WriteFile(options.output_file, "w", result->wgsl)) {
+    if (!WriteOutput(options, "w", result->wgsl)) {
         return false;
     }
 
     const auto hash = tint::CRC32(result->wgsl.data(), result->wgsl.size());
     if (options.print_hash) {
-        PrintHash(hash);
+        PrintHash(StdOut(options), hash);
     }
 
 #if TINT_BUILD_WGSL_READER
@@ -837,7 +935,12 @@ bool GenerateWgsl([[maybe_unused]] const tint::Program& program,
         auto reparsed_program = tint::wgsl::reader::Parse(source.get(), parser_options);
         if (!reparsed_program.IsValid()) {
             tint::diag::Formatter diag_formatter;
-            options.printer->Print(diag_formatter.Format(reparsed_program.Diagnostics()));
+            auto diags = diag_formatter.Format(reparsed_program.Diagnostics());
+            if (options.stderr_capture) {
+                *options.stderr_capture << diags.Plain();
+            } else {
+                options.printer->Print(diags);
+            }
             return false;
         }
     }
@@ -845,7 +948,7 @@ bool GenerateWgsl([[maybe_unused]] const tint::Program& program,
 
     return true;
 #else
-    std::cerr << "WGSL writer not enabled in tint build" << std::endl;
+    StdErr(options) << "WGSL writer not enabled in tint build" << std::endl;
     return false;
 #endif  // TINT_BUILD_WGSL_WRITER
 }
@@ -857,7 +960,7 @@ bool GenerateWgsl([[maybe_unused]] const tint::Program& program,
 bool GenerateMsl([[maybe_unused]] const tint::Program& program,
                  [[maybe_unused]] const Options& options) {
 #if !TINT_BUILD_MSL_WRITER
-    std::cerr << "MSL writer not enabled in tint build" << std::endl;
+    StdErr(options) << "MSL writer not enabled in tint build" << std::endl;
     return false;
 #else
     // Remap resource numbers to a flat namespace.
@@ -875,6 +978,7 @@ bool GenerateMsl([[maybe_unused]] const tint::Program& program,
     gen_options.pixel_local_options = options.pixel_local_options;
     gen_options.bindings = tint::msl::writer::GenerateBindings(*input_program);
     gen_options.array_length_from_uniform.ubo_binding = 30;
+    gen_options.ir_passes = options.ir_passes;
 
     // Add array_length_from_uniform entries for all storage buffers with runtime sized arrays.
     std::unordered_set<tint::BindingPoint> storage_bindings;
@@ -894,7 +998,7 @@ bool GenerateMsl([[maybe_unused]] const tint::Program& program,
         // Convert the AST program to an IR module.
         auto ir = tint::wgsl::reader::ProgramToLoweredIR(program);
         if (ir != tint::Success) {
-            std::cerr << "Failed to generate IR: " << ir << "\n";
+            StdErr(options) << "Failed to generate IR: " << ir << "\n";
             return false;
         }
         result = tint::msl::writer::Generate(ir.Get(), gen_options);
@@ -903,18 +1007,22 @@ bool GenerateMsl([[maybe_unused]] const tint::Program& program,
     }
 
     if (result != tint::Success) {
-        tint::cmd::PrintWGSL(std::cerr, program);
-        std::cerr << "Failed to generate: " << result.Failure() << "\n";
+        tint::cmd::PrintWGSL(StdErr(options), program);
+        StdErr(options) << "Failed to generate: " << result.Failure() << "\n";
         return false;
     }
 
-    if (!WriteFile(options.output_file, "w", result->msl)) {
+    if (options.ir_passes.collect_stats) {
+        PrintIRPassStats(StdErr(options), result->ir_pass_stats);
+    }
+
+    if (!WriteOutput(options, "w", result->msl)) {
         return false;
     }
 
     const auto hash = tint::CRC32(result->msl.c_str());
     if (options.print_hash) {
-        PrintHash(hash);
+        PrintHash(StdOut(options), hash);
     }
 
     // Default to validating against MSL 1.2.
@@ -950,7 +1058,7 @@ bool GenerateMsl([[maybe_unused]] const tint::Program& program,
         }
 #endif  // TINT_BUILD_IS_MAC
         if (res.failed) {
-            std::cerr << res.output << "\n";
+            StdErr(options) << res.output << "\n";
             return false;
         }
     }
@@ -982,18 +1090,18 @@ bool GenerateHlsl(const tint::Program& program, const Options& options) {
         options.hlsl_shader_model < kMinShaderModelForPackUnpack4x8InHLSL;
     auto result = tint::hlsl::writer::Generate(program, gen_options);
     if (result != tint::Success) {
-        tint::cmd::PrintWGSL(std::cerr, program);
-        std::cerr << "Failed to generate: " << result.Failure() << std::endl;
+        tint::cmd::PrintWGSL(StdErr(options), program);
+        StdErr(options) << "Failed to generate: " << result.Failure() << std::endl;
         return false;
     }
 
-    if (!WriteFile(options.output_file, "w", result->hlsl)) {
+    if (!WriteOutput(options, "w", result->hlsl)) {
         return false;
     }
 
     const auto hash = tint::CRC32(result->hlsl.c_str());
     if (options.print_hash) {
-        PrintHash(hash);
+        PrintHash(StdOut(options), hash);
     }
 
     if ((options.validate || must_validate_dxc || must_validate_fxc) &&
@@ -1053,28 +1161,31 @@ bool GenerateHlsl(const tint::Program& program, const Options& options) {
         }
 
         if (fxc_res.failed) {
-            std::cerr << "FXC validation failure:" << std::endl << fxc_res.output << std::endl;
+            StdErr(options) << "FXC validation failure:" << std::endl
+                            << fxc_res.output << std::endl;
         }
         if (dxc_res.failed) {
-            std::cerr << "DXC validation failure:" << std::endl << dxc_res.output << std::endl;
+            StdErr(options) << "DXC validation failure:" << std::endl
+                            << dxc_res.output << std::endl;
         }
         if (fxc_res.failed || dxc_res.failed) {
             return false;
         }
         if (!fxc_found && !dxc_found) {
-            std::cerr << "Couldn't find FXC or DXC. Cannot validate" << std::endl;
+            StdErr(options) << "Couldn't find FXC or DXC. Cannot validate" << std::endl;
             return false;
         }
         if (options.verbose) {
+            auto& out = StdOut(options);
             if (fxc_found && !fxc_res.failed) {
-                std::cout << "Passed FXC validation" << std::endl;
-                std::cout << fxc_res.output;
-                std::cout << std::endl;
+                out << "Passed FXC validation" << std::endl;
+                out << fxc_res.output;
+                out << std::endl;
             }
             if (dxc_found && !dxc_res.failed) {
-                std::cout << "Passed DXC validation" << std::endl;
-                std::cout << dxc_res.output;
-                std::cout << std::endl;
+                out << "Passed DXC validation" << std::endl;
+                out << dxc_res.output;
+                out << std::endl;
             }
         }
     }
@@ -1083,7 +1194,7 @@ bool GenerateHlsl(const tint::Program& program, const Options& options) {
 #else
     (void)program;
     (void)options;
-    std::cerr << "HLSL writer not enabled in tint build\n";
+    StdErr(options) << "HLSL writer not enabled in tint build\n";
     return false;
 #endif  // TINT_BUILD_HLSL_WRITER
 }
@@ -1095,7 +1206,7 @@ bool GenerateHlsl(const tint::Program& program, const Options& options) {
 bool GenerateGlsl([[maybe_unused]] const tint::Program& program,
                   [[maybe_unused]] const Options& options) {
 #if !TINT_BUILD_GLSL_WRITER
-    std::cerr << "GLSL writer not enabled in tint build" << std::endl;
+    StdErr(options) << "GLSL writer not enabled in tint build" << std::endl;
     return false;
 #else
     tint::inspector::Inspector inspector(program);
@@ -1141,30 +1252,30 @@ bool GenerateGlsl([[maybe_unused]] const tint::Program& program,
 
         auto result = tint::glsl::writer::Generate(prg, gen_options, entry_point_name);
         if (result != tint::Success) {
-            tint::cmd::PrintWGSL(std::cerr, prg);
-            std::cerr << "Failed to generate: " << result.Failure() << "\n";
+            tint::cmd::PrintWGSL(StdErr(options), prg);
+            StdErr(options) << "Failed to generate: " << result.Failure() << "\n";
             return false;
         }
 
-        if (!WriteFile(options.output_file, "w", result->glsl)) {
+        if (!WriteOutput(options, "w", result->glsl)) {
             return false;
         }
 
         const auto hash = tint::CRC32(result->glsl.c_str());
         if (options.print_hash) {
-            PrintHash(hash);
+            PrintHash(StdOut(options), hash);
         }
 
         if (options.validate && options.skip_hash.count(hash) == 0) {
 #if !TINT_BUILD_GLSL_VALIDATOR
-            std::cerr << "GLSL validator not enabled in tint build" << std::endl;
+            StdErr(options) << "GLSL validator not enabled in tint build" << std::endl;
             return false;
 #else
             // If there is no entry point name there is nothing to validate
             if (entry_point_name != "") {
                 auto val = tint::glsl::validate::Validate(result->glsl, stage);
                 if (val != tint::Success) {
-                    std::cerr << val.Failure();
+                    StdErr(options) << val.Failure();
                     return false;
                 }
             }
@@ -1199,6 +1310,135 @@ bool GenerateGlsl([[maybe_unused]] const tint::Program& program,
 #endif  // TINT_BUILD_GLSL_WRITER
 }
 
+/// Generate code for a program, using the output format specified by the options.
+/// @param program the program to generate
+/// @param options the options that Tint was invoked with
+/// @returns true on success
+bool Generate(const tint::Program& program, const Options& options) {
+    bool success = false;
+    switch (options.format) {
+        case Format::kSpirv:
+        case Format::kSpvAsm:
+            success = GenerateSpirv(program, options);
+            break;
+        case Format::kWgsl:
+            success = GenerateWgsl(program, options);
+            break;
+        case Format::kMsl:
+            success = GenerateMsl(program, options);
+            break;
+        case Format::kHlsl:
+            success = GenerateHlsl(program, options);
+            break;
+        case Format::kGlsl:
+            success = GenerateGlsl(program, options);
+            break;
+        case Format::kNone:
+            break;
+        default:
+            StdErr(options) << "Unknown output format specified\n";
+            return false;
+    }
+    return success;
+}
+
+/// Transforms and generates each entry point of a program independently, using up to
+/// `options.jobs` threads. Each entry point is stripped down with the SingleEntryPoint transform
+/// before the remaining transforms are run. Standard output, transform errors and generator errors
+/// are captured per entry point, and emitted in entry point order once all the entry points have
+/// been generated.
+/// @param program the program to generate
+/// @param options the options that Tint was invoked with
+/// @param add_transforms a function that adds the renamer and user-requested transforms to a
+/// transform manager
+/// @returns true on success
+bool GenerateSplitEntryPoints(
+    const tint::Program& program,
+    const Options& options,
+    const std::function<bool(tint::ast::transform::Manager&, tint::ast::transform::DataMap&)>&
+        add_transforms) {
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    struct Transforms {
+        tint::ast::transform::Manager manager;
+        tint::ast::transform::DataMap inputs;
+        Milliseconds transform_time{};
+        Milliseconds generate_time{};
+    };
+
+    tint::Vector<std::string, 8> entry_points;
+    if (options.emit_single_entry_point) {
+        entry_points.Push(options.ep_name);
+    } else {
+        tint::inspector::Inspector inspector(program);
+        for (auto& entry_point : inspector.GetEntryPoints()) {
+            entry_points.Push(entry_point.name);
+        }
+    }
+    if (entry_points.IsEmpty()) {
+        std::cerr << "Program has no entry points to generate\n";
+        return false;
+    }
+
+    // Build the transforms for each entry point up front, as the transform factories may inspect
+    // the program and report errors.
+    std::vector<Transforms> transforms(entry_points.Length());
+    for (size_t i = 0; i < transforms.size(); i++) {
+        auto& t = transforms[i];
+        // Strip the program down to the entry point before running any other transforms, so that
+        // they only process the code used by the entry point.
+        t.manager.Add<tint::ast::transform::SingleEntryPoint>();
+        t.inputs.Add<tint::ast::transform::SingleEntryPoint::Config>(entry_points[i]);
+        if (!add_transforms(t.manager, t.inputs)) {
+            return false;
+        }
+    }
+
+    auto generate = [&](tint::cmd::EntryPointJob& job) {
+        auto& t = transforms[job.index];
+        auto start = Clock::now();
+        tint::ast::transform::DataMap outputs;
+        auto transformed = t.manager.Run(program, std::move(t.inputs), outputs);
+        t.transform_time = Clock::now() - start;
+        if (!transformed.IsValid()) {
+            tint::cmd::PrintWGSL(job.err, transformed);
+            job.err << transformed.Diagnostics() << "\n";
+            return false;
+        }
+
+        Options job_options = options;
+        job_options.output_file = job.output_file;
+        job_options.stdout_capture = &job.out;
+        job_options.stderr_capture = &job.err;
+
+        start = Clock::now();
+        bool success = Generate(transformed, job_options);
+        t.generate_time = Clock::now() - start;
+        return success;
+    };
+
+    size_t num_threads = options.jobs > 0 ? options.jobs : std::thread::hardware_concurrency();
+    num_threads = std::clamp<size_t>(num_threads, 1, entry_points.Length());
+
+    auto start = Clock::now();
+    bool success = tint::cmd::GenerateEntryPoints(entry_points, options.output_file, num_threads,
+                                                  std::cout, std::cerr, generate);
+    Milliseconds total_time = Clock::now() - start;
+
+    if (options.verbose) {
+        for (size_t i = 0; i < transforms.size(); i++) {
+            std::cerr << "entry point '" << entry_points[i]
+                      << "': transform: " << transforms[i].transform_time.count()
+                      << "ms, generate: " << transforms[i].generate_time.count() << "ms\n";
+        }
+        std::cerr << "generated " << entry_points.Length() << " entry points in "
+                  << total_time.count() << "ms using " << num_threads << " threads\n";
+    }
+
+    return success;
+}
+
 }  // namespace
 
 int main(int argc, const char** argv) {
@@ -1353,75 +1593,88 @@ int main(int argc, const char** argv) {
         tint::cmd::PrintInspectorBindings(inspector);
     }
 
-    tint::ast::transform::Manager transform_manager;
-    tint::ast::transform::DataMap transform_inputs;
-
-    // Renaming must always come first
-    switch (options.format) {
-        case Format::kMsl: {
+    // Adds the renamer and the user-requested transforms to the transform manager.
+    auto add_transforms = [&](tint::ast::transform::Manager& transform_manager,
+                              tint::ast::transform::DataMap& transform_inputs) {
+        // Renaming must always come first
+        switch (options.format) {
+            case Format::kMsl: {
 #if TINT_BUILD_MSL_WRITER
-            transform_inputs.Add<tint::ast::transform::Renamer::Config>(
-                options.rename_all ? tint::ast::transform::Renamer::Target::kAll
-                                   : tint::ast::transform::Renamer::Target::kMslKeywords,
-                /* preserve_unicode */ false);
-            transform_manager.Add<tint::ast::transform::Renamer>();
+                transform_inputs.Add<tint::ast::transform::Renamer::Config>(
+                    options.rename_all ? tint::ast::transform::Renamer::Target::kAll
+                                       : tint::ast::transform::Renamer::Target::kMslKeywords,
+                    /* preserve_unicode */ false);
+                transform_manager.Add<tint::ast::transform::Renamer>();
 #endif  // TINT_BUILD_MSL_WRITER
-            break;
-        }
+                break;
+            }
 #if TINT_BUILD_GLSL_WRITER
-        case Format::kGlsl: {
-            transform_inputs.Add<tint::ast::transform::Renamer::Config>(
-                options.rename_all ? tint::ast::transform::Renamer::Target::kAll
-                                   : tint::ast::transform::Renamer::Target::kGlslKeywords,
-                /* preserve_unicode */ false);
-            transform_manager.Add<tint::ast::transform::Renamer>();
-            break;
-        }
+            case Format::kGlsl: {
+                transform_inputs.Add<tint::ast::transform::Renamer::Config>(
+                    options.rename_all ? tint::ast::transform::Renamer::Target::kAll
+                                       : tint::ast::transform::Renamer::Target::kGlslKeywords,
+                    /* preserve_unicode */ false);
+                transform_manager.Add<tint::ast::transform::Renamer>();
+                break;
+            }
 #endif  // TINT_BUILD_GLSL_WRITER
-        case Format::kHlsl: {
+            case Format::kHlsl: {
 #if TINT_BUILD_HLSL_WRITER
-            transform_inputs.Add<tint::ast::transform::Renamer::Config>(
-                options.rename_all ? tint::ast::transform::Renamer::Target::kAll
-                                   : tint::ast::transform::Renamer::Target::kHlslKeywords,
-                /* preserve_unicode */ false);
-            transform_manager.Add<tint::ast::transform::Renamer>();
+                transform_inputs.Add<tint::ast::transform::Renamer::Config>(
+                    options.rename_all ? tint::ast::transform::Renamer::Target::kAll
+                                       : tint::ast::transform::Renamer::Target::kHlslKeywords,
+                    /* preserve_unicode */ false);
+                transform_manager.Add<tint::ast::transform::Renamer>();
 #endif  // TINT_BUILD_HLSL_WRITER
-            break;
+                break;
+            }
+            default: {
+                if (options.rename_all) {
+                    transform_manager.Add<tint::ast::transform::Renamer>();
+                }
+                break;
+            }
         }
-        default: {
-            if (options.rename_all) {
-                transform_manager.Add<tint::ast::transform::Renamer>();
+
+        auto enable_transform = [&](std::string_view name) {
+            for (auto& t : transforms) {
+                if (t.name == name) {
+                    return t.make(inspector, transform_manager, transform_inputs);
+                }
+            }
+
+            std::cerr << "Unknown transform: " << name << "\n";
+            std::cerr << "Available transforms: \n" << transform_names() << "\n";
+            return false;
+        };
+
+        // If overrides are provided, add the SubstituteOverride transform.
+        if (!options.overrides.IsEmpty()) {
+            if (!enable_transform("substitute_override")) {
+                return false;
             }
-            break;
         }
-    }
 
-    auto enable_transform = [&](std::string_view name) {
-        for (auto& t : transforms) {
-            if (t.name == name) {
-                return t.make(inspector, transform_manager, transform_inputs);
+        for (const auto& name : options.transforms) {
+            // TODO(dsinclair): The vertex pulling transform requires setup code to
+            // be run that needs user input. Should we find a way to support that here
+            // maybe through a provided file?
+            if (!enable_transform(name)) {
+                return false;
             }
         }
 
-        std::cerr << "Unknown transform: " << name << "\n";
-        std::cerr << "Available transforms: \n" << transform_names() << "\n";
-        return false;
+        return true;
     };
 
-    // If overrides are provided, add the SubstituteOverride transform.
-    if (!options.overrides.IsEmpty()) {
-        if (!enable_transform("substitute_override")) {
-            return 1;
-        }
+    if (options.split_entry_points) {
+        return GenerateSplitEntryPoints(info.program, options, add_transforms) ? 0 : 1;
     }
 
-    for (const auto& name : options.transforms) {
-        // TODO(dsinclair): The vertex pulling transform requires setup code to
-        // be run that needs user input. Should we find a way to support that here
-        // maybe through a provided file?
-        if (!enable_transform(name)) {
-            return 1;
-        }
+    tint::ast::transform::Manager transform_manager;
+    tint::ast::transform::DataMap transform_inputs;
+    if (!add_transforms(transform_manager, transform_inputs)) {
+        return 1;
     }
 
     if (options.emit_single_entry_point) {
@@ -1437,31 +1690,7 @@ int main(int argc, const char** argv) {
         return 1;
     }
 
-    bool success = false;
-    switch (options.format) {
-        case Format::kSpirv:
-        case Format::kSpvAsm:
-            success = GenerateSpirv(program, options);
-            break;
-        case Format::kWgsl:
-            success = GenerateWgsl(program, options);
-            break;
-        case Format::kMsl:
-            success = GenerateMsl(program, options);
-            break;
-        case Format::kHlsl:
-            success = GenerateHlsl(program, options);
-            break;
-        case Format::kGlsl:
-            success = GenerateGlsl(program, options);
-            break;
-        case Format::kNone:
-            break;
-        default:
-            std::cerr << "Unknown output format specified\n";
-            return 1;
-    }
-    if (!success) {
+    if (!Generate(program, options)) {
         return 1;
     }
 
@@ -523,6 +523,15 @@ Eval::Result TransformUnaryElements(Manager& mgr,
 
     auto* composite_el_ty = composite_ty->Elements(composite_ty).type;
 
+    if (auto* splat = c0->As<Splat>()) {
+        // Every element of a splat is the same, so only transform it once.
+        auto el = TransformUnaryElements(mgr, composite_el_ty, f, splat->el);
+        if (el != Success) {
+            return el.Failure();
+        }
+        return mgr.Splat(composite_ty, el.Get(), n);
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(n);
     for (uint32_t i = 0; i < n; i++) {
@@ -555,6 +564,17 @@ Eval::Result TransformBinaryElements(Manager& mgr,
 
     auto* composite_el_ty = composite_ty->Elements(composite_ty).type;
 
+    auto* splat0 = c0->As<Splat>();
+    auto* splat1 = c1->As<Splat>();
+    if (splat0 && splat1) {
+        // Every element of both operands is the same, so only transform one pair.
+        auto el = TransformBinaryElements(mgr, composite_el_ty, f, splat0->el, splat1->el);
+        if (el != Success) {
+            return el.Failure();
+        }
+        return mgr.Splat(composite_ty, el.Get(), n);
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(n);
     for (uint32_t i = 0; i < n; i++) {
@@ -587,6 +607,25 @@ Eval::Result TransformBinaryDifferingArityElements(Manager& mgr,
 
     const auto* element_ty = composite_ty->Elements(composite_ty).type;
 
+    // If each operand is either a scalar or a splat, then every element of the result is the
+    // same, so only transform one pair.
+    auto splat_el = [&](const Value* c, uint32_t num_elems) -> const Value* {
+        if (num_elems == 1) {
+            return c;
+        }
+        auto* splat = c->As<Splat>();
+        return splat ? splat->el : nullptr;
+    };
+    if (auto* el0 = splat_el(c0, n0)) {
+        if (auto* el1 = splat_el(c1, n1)) {
+            auto el = TransformBinaryDifferingArityElements(mgr, element_ty, f, el0, el1);
+            if (el != Success) {
+                return el.Failure();
+            }
+            return mgr.Splat(composite_ty, el.Get(), max_n);
+        }
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(max_n);
     for (uint32_t i = 0; i < max_n; i++) {
@@ -623,6 +662,19 @@ Eval::Result TransformTernaryElements(Manager& mgr,
 
     auto* composite_el_ty = composite_ty->Elements(composite_ty).type;
 
+    auto* splat0 = c0->As<Splat>();
+    auto* splat1 = c1->As<Splat>();
+    auto* splat2 = c2->As<Splat>();
+    if (splat0 && splat1 && splat2) {
+        // Every element of all three operands is the same, so only transform one triple.
+        auto el =
+            TransformTernaryElements(mgr, composite_el_ty, f, splat0->el, splat1->el, splat2->el);
+        if (el != Success) {
+            return el.Failure();
+        }
+        return mgr.Splat(composite_ty, el.Get(), n);
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(n);
     for (uint32_t i = 0; i < n; i++) {
@@ -4007,9 +4059,29 @@ Eval::Result Eval::Convert(const core::type::Type* target_ty,
     if (value->Type() == target_ty) {
         return value;
     }
+
+    // Converting a composite rebuilds the whole value tree. The same abstract composite is often
+    // materialized many times, for example a `const` lookup table that is indexed in several
+    // places, so reuse the result of an earlier conversion of the same value.
+    const bool is_composite = value->Is<constant::Composite>();
+    if (is_composite) {
+        if (auto cached = conversions_.Get(std::make_pair(value, target_ty))) {
+            return *cached;
+        }
+    }
+
     ConvertContext ctx{mgr, diags, source, use_runtime_semantics_};
+    const size_t num_diags = diags.Count();
     auto* converted = ConvertInternal(value, target_ty, ctx);
-    return converted ? Result(converted) : Result(error);
+    if (!converted) {
+        return error;
+    }
+    // Conversions that raised a diagnostic are not recorded, so that the diagnostic is raised again
+    // for each conversion.
+    if (is_composite && diags.Count() == num_diags) {
+        conversions_.Add(std::make_pair(value, target_ty), converted);
+    }
+    return converted;
 }
 
 diag::Diagnostic& Eval::AddError(const Source& source) const {
@@ -31,9 +31,11 @@
 #include <stddef.h>
 #include <algorithm>
 #include <string>
+#include <utility>
 
 #include "src/tint/lang/core/number.h"
 #include "src/tint/lang/core/type/type.h"
+#include "src/tint/utils/containers/hashmap.h"
 #include "src/tint/utils/containers/vector.h"
 #include "src/tint/utils/result/result.h"
 
@@ -1355,6 +1357,10 @@ class Eval {
     Manager& mgr;
     diag::List& diags;
     bool use_runtime_semantics_ = false;
+
+    /// The results of previous conversions of composite values by Convert(), keyed by the source
+    /// value and the target type.
+    Hashmap<std::pair<const Value*, const core::type::Type*>, const Value*, 8> conversions_;
 };
 
 }  // namespace tint::core::constant
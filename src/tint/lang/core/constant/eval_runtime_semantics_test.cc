@@ -28,6 +28,7 @@
 #include "src/tint/lang/core/constant/eval_test.h"
 
 #include "src/tint/lang/core/constant/scalar.h"
+#include "src/tint/lang/core/constant/splat.h"
 
 using namespace tint::core::number_suffixes;  // NOLINT
 
@@ -566,6 +567,41 @@ TEST_F(ConstEvalRuntimeSemanticsTest, Convert_F16_TooLow) {
     EXPECT_EQ(error(), R"(warning: value -1000000.0 cannot be represented as 'f16')");
 }
 
+TEST_F(ConstEvalRuntimeSemanticsTest, Convert_Vec_Reused) {
+    auto* vec2a = create<core::type::Vector>(create<core::type::AbstractFloat>(), 2u);
+    auto* vec2f = create<core::type::Vector>(create<core::type::F32>(), 2u);
+    auto* a = constants.Composite(vec2a, Vector{
+                                             constants.Get(AFloat(1)),
+                                             constants.Get(AFloat(2)),
+                                         });
+    auto first = eval.Convert(vec2f, a, {});
+    ASSERT_EQ(first, Success);
+    auto second = eval.Convert(vec2f, a, {});
+    ASSERT_EQ(second, Success);
+    EXPECT_EQ(first.Get(), second.Get());
+    EXPECT_EQ(first.Get()->Type(), vec2f);
+    EXPECT_EQ(first.Get()->Index(0)->ValueAs<f32>(), 1.f);
+    EXPECT_EQ(first.Get()->Index(1)->ValueAs<f32>(), 2.f);
+    EXPECT_EQ(error(), "");
+}
+
+TEST_F(ConstEvalRuntimeSemanticsTest, Convert_Vec_TooHigh_WarnsEachTime) {
+    auto* vec2f = create<core::type::Vector>(create<core::type::F32>(), 2u);
+    auto* vec2h = create<core::type::Vector>(create<core::type::F16>(), 2u);
+    auto* a = constants.Composite(vec2f, Vector{
+                                             constants.Get(f32(1)),
+                                             constants.Get(f32(1000000.0)),
+                                         });
+    auto first = eval.Convert(vec2h, a, {});
+    ASSERT_EQ(first, Success);
+    auto second = eval.Convert(vec2h, a, {});
+    ASSERT_EQ(second, Success);
+    EXPECT_EQ(first.Get(), second.Get());
+    EXPECT_EQ(second.Get()->Index(1)->ValueAs<f16>(), f16::kHighestValue);
+    EXPECT_EQ(error(), R"(warning: value 1000000.0 cannot be represented as 'f16'
+warning: value 1000000.0 cannot be represented as 'f16')");
+}
+
 TEST_F(ConstEvalRuntimeSemanticsTest, Vec_Overflow_SingleComponent) {
     // Test that overflow for an element-wise vector operation only affects a single component.
     auto* vec4f = create<core::type::Vector>(create<core::type::F32>(), 4u);
@@ -587,5 +623,45 @@ TEST_F(ConstEvalRuntimeSemanticsTest, Vec_Overflow_SingleComponent) {
     EXPECT_EQ(error(), R"(warning: sqrt must be called with a value >= 0)");
 }
 
+TEST_F(ConstEvalRuntimeSemanticsTest, Vec_Splat_Unary) {
+    // Test that an element-wise operation on a splat produces a splat, and only evaluates the
+    // splatted element once.
+    auto* vec4f = create<core::type::Vector>(create<core::type::F32>(), 4u);
+    auto* a = eval.VecSplat(vec4f, Vector{constants.Get(f32(-1))}, {}).Get();
+    auto result = eval.sqrt(a->Type(), Vector{a}, {});
+    ASSERT_EQ(result, Success);
+    ASSERT_TRUE(result.Get()->Is<Splat>());
+    EXPECT_EQ(result.Get()->Type(), vec4f);
+    EXPECT_EQ(result.Get()->NumElements(), 4u);
+    EXPECT_EQ(result.Get()->Index(3)->ValueAs<f32>(), 0.f);
+    EXPECT_EQ(error(), R"(warning: sqrt must be called with a value >= 0)");
+}
+
+TEST_F(ConstEvalRuntimeSemanticsTest, Vec_Splat_Binary_Scalar) {
+    auto* vec3f = create<core::type::Vector>(create<core::type::F32>(), 3u);
+    auto* a = eval.VecSplat(vec3f, Vector{constants.Get(f32(1.5))}, {}).Get();
+    auto* b = constants.Get(f32(2));
+    auto result = eval.Multiply(vec3f, Vector{a, b}, {});
+    ASSERT_EQ(result, Success);
+    ASSERT_TRUE(result.Get()->Is<Splat>());
+    EXPECT_EQ(result.Get()->Type(), vec3f);
+    EXPECT_EQ(result.Get()->Index(0)->ValueAs<f32>(), 3.f);
+    EXPECT_EQ(result.Get()->Index(2)->ValueAs<f32>(), 3.f);
+    EXPECT_EQ(error(), "");
+}
+
+TEST_F(ConstEvalRuntimeSemanticsTest, Vec_Splat_Binary_Mixed) {
+    // Test that a splat combined with a non-splat composite is still evaluated per element.
+    auto* vec2f = create<core::type::Vector>(create<core::type::F32>(), 2u);
+    auto* a = eval.VecSplat(vec2f, Vector{constants.Get(f32(1))}, {}).Get();
+    auto* b = eval.VecInitS(vec2f, Vector{constants.Get(f32(2)), constants.Get(f32(3))}, {}).Get();
+    auto result = eval.Plus(vec2f, Vector{a, b}, {});
+    ASSERT_EQ(result, Success);
+    EXPECT_FALSE(result.Get()->Is<Splat>());
+    EXPECT_EQ(result.Get()->Index(0)->ValueAs<f32>(), 3.f);
+    EXPECT_EQ(result.Get()->Index(1)->ValueAs<f32>(), 4.f);
+    EXPECT_EQ(error(), "");
+}
+
 }  // namespace
 }  // namespace tint::core::constant::test
@@ -211,6 +211,10 @@ Result<Overload, StyledText> MatchIntrinsic(Context& context,
 
     // How many candidates matched?
     if (TINT_UNLIKELY(num_matched == 0)) {
+        if (!context.detailed_errors) {
+            // The candidates are not listed, so skip the full scoring.
+            return on_no_match(Empty);
+        }
         // Perform the full scoring of each overload
         for (size_t overload_idx = 0; overload_idx < num_overloads; overload_idx++) {
             auto& overload = context.data[intrinsic.overloads + overload_idx];
@@ -39,6 +39,7 @@
 #include "src/tint/lang/core/intrinsic/table_data.h"
 #include "src/tint/lang/core/parameter_usage.h"
 #include "src/tint/lang/core/unary_op.h"
+#include "src/tint/utils/containers/hashmap.h"
 #include "src/tint/utils/containers/vector.h"
 #include "src/tint/utils/text/string.h"
 #include "src/tint/utils/text/string_stream.h"
@@ -109,6 +110,9 @@ struct Context {
     core::type::Manager& types;
     /// The symbol table
     SymbolTable& symbols;
+    /// If false, then a failed lookup produces a one-line error message, skipping the scoring
+    /// and printing of every candidate overload. Used when only the success of a lookup matters.
+    bool detailed_errors = true;
 
     /// @returns a MatchState from the context and arguments.
     /// @param templates the template state used for matcher evaluation
@@ -226,6 +230,8 @@ Result<Overload, StyledText> LookupCtorConv(Context& context,
                                             EvaluationStage earliest_eval_stage);
 
 /// Table is a wrapper around a dialect to provide type-safe interface to the intrinsic table.
+/// Table memoizes successful lookups, so repeated lookups with the same signature do not need to
+/// re-run overload resolution.
 template <typename DIALECT>
 struct Table {
     /// Alias to DIALECT::BuiltinFn
@@ -258,10 +264,11 @@ struct Table {
                                         VectorRef<const core::type::Type*> template_args,
                                         VectorRef<const core::type::Type*> args,
                                         EvaluationStage earliest_eval_stage) {
-        std::string_view name = DIALECT::ToString(builtin_fn);
         size_t id = static_cast<size_t>(builtin_fn);
-        return LookupFn(context, name, id, std::move(template_args), std::move(args),
-                        earliest_eval_stage);
+        return Cached(CacheKey::kFn, id, template_args, args, earliest_eval_stage, [&] {
+            std::string_view name = DIALECT::ToString(builtin_fn);
+            return LookupFn(context, name, id, template_args, args, earliest_eval_stage);
+        });
     }
 
     /// Lookup looks for the unary op overload with the given signature, raising an error
@@ -279,7 +286,9 @@ struct Table {
     Result<Overload, StyledText> Lookup(core::UnaryOp op,
                                         const core::type::Type* arg,
                                         EvaluationStage earliest_eval_stage) {
-        return LookupUnary(context, op, arg, earliest_eval_stage);
+        size_t id = static_cast<size_t>(op);
+        return Cached(CacheKey::kUnary, id, tint::Empty, Vector{arg}, earliest_eval_stage,
+                      [&] { return LookupUnary(context, op, arg, earliest_eval_stage); });
     }
 
     /// Lookup looks for the binary op overload with the given signature, raising an error
@@ -301,7 +310,11 @@ struct Table {
                                         const core::type::Type* rhs,
                                         EvaluationStage earliest_eval_stage,
                                         bool is_compound) {
-        return LookupBinary(context, op, lhs, rhs, earliest_eval_stage, is_compound);
+        size_t id = static_cast<size_t>(op);
+        auto kind = is_compound ? CacheKey::kCompoundBinary : CacheKey::kBinary;
+        return Cached(kind, id, tint::Empty, Vector{lhs, rhs}, earliest_eval_stage, [&] {
+            return LookupBinary(context, op, lhs, rhs, earliest_eval_stage, is_compound);
+        });
     }
 
     /// Lookup looks for the value constructor or conversion overload for the given CtorConv.
@@ -319,14 +332,91 @@ struct Table {
                                         VectorRef<const core::type::Type*> template_args,
                                         VectorRef<const core::type::Type*> args,
                                         EvaluationStage earliest_eval_stage) {
-        std::string_view name = DIALECT::ToString(type);
         size_t id = static_cast<size_t>(type);
-        return LookupCtorConv(context, name, id, std::move(template_args), std::move(args),
-                              earliest_eval_stage);
+        return Cached(CacheKey::kCtorConv, id, template_args, args, earliest_eval_stage, [&] {
+            std::string_view name = DIALECT::ToString(type);
+            return LookupCtorConv(context, name, id, template_args, args, earliest_eval_stage);
+        });
     }
 
     /// The intrinsic context
     Context context;
+
+  private:
+    /// CacheKey is the signature of a lookup, used as the key of the overload cache.
+    struct CacheKey {
+        /// The kind of intrinsic being looked up
+        enum Kind : uint8_t {
+            kFn,
+            kUnary,
+            kBinary,
+            kCompoundBinary,
+            kCtorConv,
+        };
+
+        /// The kind of intrinsic
+        Kind kind;
+        /// The builtin function, operator or type identifier
+        size_t id;
+        /// The earliest evaluation stage of the lookup
+        EvaluationStage earliest_eval_stage;
+        /// The number of template arguments at the front of #types
+        size_t num_template_args;
+        /// The template argument types, followed by the argument types
+        Vector<const core::type::Type*, 4> types;
+
+        /// @returns the hash code of the key
+        tint::HashCode HashCode() const {
+            return Hash(kind, id, earliest_eval_stage, num_template_args, types);
+        }
+
+        /// Equality operator
+        /// @param other the key to compare against
+        /// @returns true if this key and @p other are the same
+        bool operator==(const CacheKey& other) const {
+            return kind == other.kind && id == other.id &&
+                   earliest_eval_stage == other.earliest_eval_stage &&
+                   num_template_args == other.num_template_args && types == other.types;
+        }
+    };
+
+    /// Cached returns the overload previously resolved for the given signature, or calls
+    /// @p lookup to resolve the overload, adding it to the cache on success.
+    /// Failures are not cached, as they build a diagnostic message for the call.
+    /// @param kind the kind of intrinsic
+    /// @param id the builtin function, operator or type identifier
+    /// @param template_args the template argument types
+    /// @param args the argument types
+    /// @param earliest_eval_stage the earliest evaluation stage of the lookup
+    /// @param lookup the function used to resolve the overload on a cache miss
+    /// @return the resolved overload
+    template <typename LOOKUP>
+    Result<Overload, StyledText> Cached(typename CacheKey::Kind kind,
+                                        size_t id,
+                                        VectorRef<const core::type::Type*> template_args,
+                                        VectorRef<const core::type::Type*> args,
+                                        EvaluationStage earliest_eval_stage,
+                                        LOOKUP&& lookup) {
+        CacheKey key{kind, id, earliest_eval_stage, template_args.Length(), {}};
+        key.types.Reserve(template_args.Length() + args.Length());
+        for (auto* ty : template_args) {
+            key.types.Push(ty);
+        }
+        for (auto* ty : args) {
+            key.types.Push(ty);
+        }
+        if (auto overload = cache_.Get(key)) {
+            return *overload;
+        }
+        auto result = lookup();
+        if (result == Success) {
+            cache_.Add(std::move(key), result.Get());
+        }
+        return result;
+    }
+
+    /// The successfully resolved overloads, keyed by lookup signature
+    Hashmap<CacheKey, Overload, 8> cache_;
 };
 
 }  // namespace tint::core::intrinsic
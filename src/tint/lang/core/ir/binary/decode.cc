@@ -27,6 +27,7 @@
 
 #include "src/tint/lang/core/ir/binary/decode.h"
 
+#include <limits>
 #include <utility>
 
 #include "src/tint/lang/core/ir/builder.h"
@@ -1348,13 +1349,21 @@ struct Decoder {
 Result<Module> Decode(Slice<const std::byte> encoded) {
     GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-    pb::Module mod_in;
-    if (!mod_in.ParseFromArray(encoded.data, static_cast<int>(encoded.len))) {
+    if (encoded.len > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        return Failure{"encoded module is too large"};
+    }
+
+    // Parse the protobuf messages into an arena. The decoded messages only live for the duration
+    // of this function, so allocating them from a few large blocks that are released together
+    // avoids a heap allocation and free for every type, value, instruction and operand.
+    google::protobuf::Arena arena;
+    auto* mod_in = google::protobuf::Arena::CreateMessage<pb::Module>(&arena);
+    if (!mod_in->ParseFromArray(encoded.data, static_cast<int>(encoded.len))) {
         return Failure{"failed to deserialize protobuf"};
     }
 
     Module mod_out;
-    Decoder{mod_in, mod_out}.Decode();
+    Decoder{*mod_in, mod_out}.Decode();
 
     return mod_out;
 }
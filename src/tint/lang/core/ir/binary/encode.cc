@@ -27,6 +27,7 @@
 
 #include "src/tint/lang/core/ir/binary/encode.h"
 
+#include <limits>
 #include <utility>
 
 #include "src/tint/lang/core/builtin_fn.h"
@@ -1128,14 +1129,19 @@ struct Encoder {
 Result<Vector<std::byte, 0>> Encode(const Module& mod_in) {
     GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-    pb::Module mod_out;
-    Encoder{mod_in, mod_out}.Encode();
+    // Build the protobuf messages in an arena, as they are discarded once serialized.
+    google::protobuf::Arena arena;
+    auto* mod_out = google::protobuf::Arena::CreateMessage<pb::Module>(&arena);
+    Encoder{mod_in, *mod_out}.Encode();
 
     Vector<std::byte, 0> buffer;
-    size_t len = mod_out.ByteSizeLong();
+    size_t len = mod_out->ByteSizeLong();
+    if (len > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        return Failure{"encoded module is too large"};
+    }
     buffer.Resize(len);
     if (len > 0) {
-        if (!mod_out.SerializeToArray(&buffer[0], static_cast<int>(len))) {
+        if (!mod_out->SerializeToArray(&buffer[0], static_cast<int>(len))) {
             return Failure{"failed to serialize protobuf"};
         }
     }
@@ -73,6 +73,13 @@ TEST_F(IRBinaryRoundtripTest, EmptyModule) {
     RUN_TEST();
 }
 
+TEST_F(IRBinaryRoundtripTest, DecodeInvalid) {
+    const std::byte data[] = {std::byte{0xff}, std::byte{0xff}, std::byte{0xff}};
+    auto decoded = Decode(Slice<const std::byte>{data});
+    ASSERT_NE(decoded, Success);
+    EXPECT_EQ(decoded.Failure().reason.Str(), "error: failed to deserialize protobuf");
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Root block
 ////////////////////////////////////////////////////////////////////////////////
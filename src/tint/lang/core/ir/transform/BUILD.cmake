@@ -60,7 +60,9 @@ tint_add_target(tint_lang_core_ir_transform lib
   lang/core/ir/transform/direct_variable_access.cc
   lang/core/ir/transform/direct_variable_access.h
   lang/core/ir/transform/multiplanar_external_texture.cc
+  lang/core/ir/transform/pass_manager.cc
   lang/core/ir/transform/multiplanar_external_texture.h
+  lang/core/ir/transform/pass_manager.h
   lang/core/ir/transform/preserve_padding.cc
   lang/core/ir/transform/preserve_padding.h
   lang/core/ir/transform/robustness.cc
@@ -117,6 +119,7 @@ tint_add_target(tint_lang_core_ir_transform_test test
   lang/core/ir/transform/direct_variable_access_test.cc
   lang/core/ir/transform/helper_test.h
   lang/core/ir/transform/multiplanar_external_texture_test.cc
+  lang/core/ir/transform/pass_manager_test.cc
   lang/core/ir/transform/preserve_padding_test.cc
   lang/core/ir/transform/robustness_test.cc
   lang/core/ir/transform/std140_test.cc
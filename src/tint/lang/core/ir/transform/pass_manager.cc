@@ -0,0 +1,99 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/transform/pass_manager.h"
+
+#include "src/tint/lang/core/ir/function.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/traverse.h"
+
+/// If set to 1 then the PassManager will collect and print the statistics of each pass when the
+/// pipeline is finished. Helpful for finding slow passes.
+#define TINT_PRINT_IR_PASS_STATS 0
+
+#if TINT_PRINT_IR_PASS_STATS
+#include <iostream>
+#endif
+
+namespace tint::core::ir::transform {
+namespace {
+
+/// @returns the number of instructions in the module @p ir
+size_t CountInstructions(Module& ir) {
+    size_t count = 0;
+    auto count_block = [&](Block* block) {
+        Traverse(block, [&](Instruction*) { count++; });
+    };
+    count_block(ir.root_block);
+    for (auto& func : ir.functions) {
+        count_block(func->Block());
+    }
+    return count;
+}
+
+}  // namespace
+
+PassManager::PassManager(Module& ir, const PassManagerConfig& config) : ir_(ir), config_(config) {
+#if TINT_PRINT_IR_PASS_STATS
+    config_.collect_stats = true;
+#endif
+    if (config_.validation != IRPassValidation::kNone) {
+        status_ = ir::Validate(ir_, config_.capabilities);
+    }
+}
+
+PassManager::~PassManager() = default;
+
+void PassManager::PassEnd(const char* name, std::chrono::nanoseconds duration) {
+    if (config_.collect_stats) {
+        stats_.Push(IRPassStats{name, duration, CountInstructions(ir_)});
+    }
+    if (status_ == Success && config_.validation == IRPassValidation::kEachPass) {
+        status_ = ir::Validate(ir_, config_.capabilities);
+    }
+}
+
+Result<SuccessType> PassManager::Finish() {
+    if (status_ == Success && config_.validation == IRPassValidation::kStartAndEnd) {
+        status_ = ir::Validate(ir_, config_.capabilities);
+    }
+
+#if TINT_PRINT_IR_PASS_STATS
+    std::cout << "=========================================================" << std::endl;
+    std::cout << "== IR pass statistics:" << std::endl;
+    std::cout << "=========================================================" << std::endl;
+    for (auto& stats : stats_) {
+        std::cout << stats.name << ": "
+                  << std::chrono::duration<double, std::micro>(stats.duration).count() << "us, "
+                  << stats.num_instructions << " instructions" << std::endl;
+    }
+#endif
+
+    return status_;
+}
+
+}  // namespace tint::core::ir::transform
@@ -0,0 +1,109 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_IR_TRANSFORM_PASS_MANAGER_H_
+#define SRC_TINT_LANG_CORE_IR_TRANSFORM_PASS_MANAGER_H_
+
+#include <chrono>
+
+#include "src/tint/api/options/ir_passes.h"
+#include "src/tint/lang/core/ir/validator.h"
+#include "src/tint/utils/containers/vector.h"
+#include "src/tint/utils/result/result.h"
+
+// Forward declarations.
+namespace tint::core::ir {
+class Module;
+}
+
+namespace tint::core::ir::transform {
+
+/// Configuration options for the PassManager.
+struct PassManagerConfig {
+    /// The validation to perform.
+    IRPassValidation validation = IRPassValidation::kNone;
+
+    /// The optional capabilities that are allowed when validating.
+    Capabilities capabilities;
+
+    /// If true, then the PassManager records the wall time and module size of each pass.
+    bool collect_stats = false;
+};
+
+/// PassManager runs a sequence of IR passes on a module, validating the module as configured and
+/// optionally recording statistics for each pass.
+///
+/// Passes are run immediately by Run(), so that the pipeline can be built with regular control
+/// flow and locally-scoped pass configurations. Finish() must be called after the last pass.
+class PassManager {
+  public:
+    /// Constructor
+    /// @param ir the module to run the passes on
+    /// @param config the pass manager configuration
+    explicit PassManager(Module& ir, const PassManagerConfig& config = {});
+
+    /// Destructor
+    ~PassManager();
+
+    /// Runs a single pass on the module, unless an earlier pass or validation has failed.
+    /// @param name the name of the pass, used for the statistics
+    /// @param pass a function with the signature `Result<SuccessType>(Module&)`
+    /// @returns the result of the pass, or the first failure of an earlier pass or validation
+    template <typename PASS>
+    Result<SuccessType> Run(const char* name, PASS&& pass) {
+        if (status_ != Success) {
+            return status_;
+        }
+        auto start = std::chrono::steady_clock::now();
+        status_ = pass(ir_);
+        PassEnd(name, std::chrono::steady_clock::now() - start);
+        return status_;
+    }
+
+    /// Completes the pipeline, performing the end-of-pipeline validation if required.
+    /// @returns success, or the first failure of a pass or validation
+    Result<SuccessType> Finish();
+
+    /// @returns the statistics recorded for each pass that has run, in order. Empty if
+    /// PassManagerConfig::collect_stats was not set.
+    VectorRef<IRPassStats> Stats() const { return stats_; }
+
+  private:
+    /// Records the statistics of the pass that has just run, and validates the module if required.
+    /// @param name the name of the pass
+    /// @param duration the wall time taken by the pass
+    void PassEnd(const char* name, std::chrono::nanoseconds duration);
+
+    Module& ir_;
+    PassManagerConfig config_;
+    Result<SuccessType> status_ = Success;
+    Vector<IRPassStats, 32> stats_;
+};
+
+}  // namespace tint::core::ir::transform
+
+#endif  // SRC_TINT_LANG_CORE_IR_TRANSFORM_PASS_MANAGER_H_
@@ -0,0 +1,154 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/transform/pass_manager.h"
+
+#include "src/tint/lang/core/ir/transform/helper_test.h"
+
+namespace tint::core::ir::transform {
+namespace {
+
+using namespace tint::core::number_suffixes;  // NOLINT
+
+using IR_PassManagerTest = TransformTest;
+
+TEST_F(IR_PassManagerTest, RunsPassesInOrder) {
+    Vector<int, 4> order;
+    PassManager passes{mod};
+    EXPECT_EQ(passes.Run("A",
+                         [&](Module&) -> Result<SuccessType> {
+                             order.Push(1);
+                             return Success;
+                         }),
+              Success);
+    EXPECT_EQ(passes.Run("B",
+                         [&](Module&) -> Result<SuccessType> {
+                             order.Push(2);
+                             return Success;
+                         }),
+              Success);
+    EXPECT_EQ(passes.Finish(), Success);
+    EXPECT_EQ(order, (Vector{1, 2}));
+    EXPECT_TRUE(passes.Stats().IsEmpty());
+}
+
+TEST_F(IR_PassManagerTest, FailureSkipsLaterPasses) {
+    bool ran = false;
+    PassManager passes{mod};
+    auto res = passes.Run("A", [&](Module&) -> Result<SuccessType> { return Failure{"oops"}; });
+    ASSERT_NE(res, Success);
+    EXPECT_EQ(res.Failure().reason.Str(), "error: oops");
+    EXPECT_NE(passes.Run("B",
+                         [&](Module&) -> Result<SuccessType> {
+                             ran = true;
+                             return Success;
+                         }),
+              Success);
+    EXPECT_FALSE(ran);
+    EXPECT_NE(passes.Finish(), Success);
+}
+
+TEST_F(IR_PassManagerTest, Stats) {
+    PassManagerConfig config;
+    config.collect_stats = true;
+    PassManager passes{mod, config};
+    EXPECT_EQ(passes.Run("AddFunction",
+                         [&](Module&) -> Result<SuccessType> {
+                             auto* func = b.Function("F", ty.void_());
+                             b.Append(func->Block(), [&] {
+                                 b.Let("x", 1_i);
+                                 b.Return(func);
+                             });
+                             return Success;
+                         }),
+              Success);
+    EXPECT_EQ(passes.Run("NoOp", [&](Module&) -> Result<SuccessType> { return Success; }),
+              Success);
+    EXPECT_EQ(passes.Finish(), Success);
+
+    auto stats = passes.Stats();
+    ASSERT_EQ(stats.Length(), 2u);
+    EXPECT_EQ(stats[0].name, "AddFunction");
+    EXPECT_EQ(stats[0].num_instructions, 2u);
+    EXPECT_EQ(stats[1].name, "NoOp");
+    EXPECT_EQ(stats[1].num_instructions, 2u);
+}
+
+/// A pass that adds a function without a terminator, which is invalid IR.
+Result<SuccessType> AddInvalidFunction(Module& mod) {
+    Builder b{mod};
+    b.Function("invalid", mod.Types().void_());
+    return Success;
+}
+
+TEST_F(IR_PassManagerTest, Validation_None) {
+    PassManager passes{mod};
+    EXPECT_EQ(passes.Run("AddInvalidFunction", AddInvalidFunction), Success);
+    EXPECT_EQ(passes.Finish(), Success);
+}
+
+TEST_F(IR_PassManagerTest, Validation_StartAndEnd) {
+    PassManagerConfig config;
+    config.validation = IRPassValidation::kStartAndEnd;
+    PassManager passes{mod, config};
+    EXPECT_EQ(passes.Run("AddInvalidFunction", AddInvalidFunction), Success);
+    EXPECT_NE(passes.Finish(), Success);
+}
+
+TEST_F(IR_PassManagerTest, Validation_EachPass) {
+    bool ran = false;
+    PassManagerConfig config;
+    config.validation = IRPassValidation::kEachPass;
+    PassManager passes{mod, config};
+    EXPECT_NE(passes.Run("AddInvalidFunction", AddInvalidFunction), Success);
+    EXPECT_NE(passes.Run("B",
+                         [&](Module&) -> Result<SuccessType> {
+                             ran = true;
+                             return Success;
+                         }),
+              Success);
+    EXPECT_FALSE(ran);
+}
+
+TEST_F(IR_PassManagerTest, Validation_InvalidInput) {
+    AddInvalidFunction(mod);
+
+    bool ran = false;
+    PassManagerConfig config;
+    config.validation = IRPassValidation::kStartAndEnd;
+    PassManager passes{mod, config};
+    EXPECT_NE(passes.Run("A",
+                         [&](Module&) -> Result<SuccessType> {
+                             ran = true;
+                             return Success;
+                         }),
+              Success);
+    EXPECT_FALSE(ran);
+}
+
+}  // namespace
+}  // namespace tint::core::ir::transform
@@ -31,6 +31,7 @@
 #include <unordered_map>
 
 #include "src/tint/api/common/binding_point.h"
+#include "src/tint/api/options/ir_passes.h"
 #include "src/tint/api/options/pixel_local.h"
 #include "src/tint/utils/reflection/reflection.h"
 
@@ -167,6 +168,9 @@ struct Options {
     /// The bindings
     Bindings bindings;
 
+    /// Options for the IR passes that raise the module to the MSL dialect
+    IRPassOptions ir_passes = {};
+
     /// Reflect the fields of this class so that it can be used by tint::ForeachField()
     TINT_REFLECT(Options,
                  disable_robustness,
@@ -177,7 +181,8 @@ struct Options {
                  fixed_sample_mask,
                  pixel_local_options,
                  array_length_from_uniform,
-                 bindings);
+                 bindings,
+                 ir_passes);
 };
 
 }  // namespace tint::msl::writer
@@ -34,6 +34,8 @@
 #include <unordered_set>
 #include <vector>
 
+#include "src/tint/api/options/ir_passes.h"
+
 namespace tint::msl::writer {
 
 /// The output produced when generating MSL.
@@ -68,6 +70,9 @@ struct Output {
     /// Indices into the array_length_from_uniform binding that are statically
     /// used.
     std::unordered_set<uint32_t> used_array_length_from_uniform_indices;
+
+    /// The statistics of each IR pass, if Options::ir_passes requested them.
+    std::vector<IRPassStats> ir_pass_stats;
 };
 
 }  // namespace tint::msl::writer
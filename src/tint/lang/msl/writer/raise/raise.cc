@@ -35,6 +35,7 @@
 #include "src/tint/lang/core/ir/transform/conversion_polyfill.h"
 #include "src/tint/lang/core/ir/transform/demote_to_helper.h"
 #include "src/tint/lang/core/ir/transform/multiplanar_external_texture.h"
+#include "src/tint/lang/core/ir/transform/pass_manager.h"
 #include "src/tint/lang/core/ir/transform/preserve_padding.h"
 #include "src/tint/lang/core/ir/transform/robustness.h"
 #include "src/tint/lang/core/ir/transform/value_to_let.h"
@@ -45,13 +46,22 @@
 
 namespace tint::msl::writer {
 
-Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
-#define RUN_TRANSFORM(name, ...)                   \
-    do {                                           \
-        auto result = name(module, ##__VA_ARGS__); \
-        if (result != Success) {                   \
-            return result;                         \
-        }                                          \
+Result<SuccessType> Raise(core::ir::Module& module,
+                          const Options& options,
+                          std::vector<IRPassStats>* pass_stats) {
+    core::ir::transform::PassManagerConfig pass_config;
+    pass_config.validation = options.ir_passes.validation;
+    pass_config.collect_stats = options.ir_passes.collect_stats;
+    core::ir::transform::PassManager passes{module, pass_config};
+
+#define RUN_TRANSFORM(name, ...)                                     \
+    do {                                                             \
+        auto result = passes.Run(#name, [&](core::ir::Module& mod) { \
+            return name(mod, ##__VA_ARGS__);                         \
+        });                                                          \
+        if (result != Success) {                                     \
+            return result;                                           \
+        }                                                            \
     } while (false)
 
     ExternalTextureOptions external_texture_options{};
@@ -107,7 +117,11 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
     RUN_TRANSFORM(core::ir::transform::ValueToLet);
     RUN_TRANSFORM(raise::BuiltinPolyfill);
 
-    return Success;
+    auto result = passes.Finish();
+    if (pass_stats) {
+        pass_stats->assign(passes.Stats().begin(), passes.Stats().end());
+    }
+    return result;
 }
 
 }  // namespace tint::msl::writer
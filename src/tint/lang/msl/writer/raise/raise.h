@@ -29,6 +29,7 @@
 #define SRC_TINT_LANG_MSL_WRITER_RAISE_RAISE_H_
 
 #include <string>
+#include <vector>
 
 #include "src/tint/lang/msl/writer/common/options.h"
 #include "src/tint/utils/diagnostic/diagnostic.h"
@@ -44,8 +45,12 @@ namespace tint::msl::writer {
 /// Raise a core IR module to the MSL dialect of the IR.
 /// @param module the core IR module to raise to MSL dialect
 /// @param options the printer options
+/// @param pass_stats if not null, the statistics of each IR pass are written to this vector when
+/// `options.ir_passes.collect_stats` is set
 /// @returns success or failure
-Result<SuccessType> Raise(core::ir::Module& module, const Options& options);
+Result<SuccessType> Raise(core::ir::Module& module,
+                          const Options& options,
+                          std::vector<IRPassStats>* pass_stats = nullptr);
 
 }  // namespace tint::msl::writer
 
@@ -53,7 +53,7 @@ Result<Output> Generate(core::ir::Module& ir, const Options& options) {
     Output output;
 
     // Raise from core-dialect to MSL-dialect.
-    if (auto res = Raise(ir, options); res != Success) {
+    if (auto res = Raise(ir, options, &output.ir_pass_stats); res != Success) {
         return res.Failure();
     }
 
@@ -30,6 +30,8 @@
 #include <cstring>
 #include <string>
 
+#include "src/tint/utils/ice/ice.h"
+
 namespace tint::spirv::writer {
 namespace {
 
@@ -39,50 +41,71 @@ const uint32_t kGeneratorId = 23u << 16;
 
 BinaryWriter::BinaryWriter() = default;
 
+BinaryWriter::BinaryWriter(WordSink& sink) : sink_(&sink) {}
+
 BinaryWriter::~BinaryWriter() = default;
 
 void BinaryWriter::WriteModule(const Module& module) {
-    out_.reserve(module.TotalSize());
-    module.Iterate([this](const Instruction& inst) { this->process_instruction(inst); });
+    // Allocate all of the module's words up front, as the size of each section is already known.
+    // The 5 is the header, which is not written by WriteModule().
+    size_t size = module.TotalSize() - 5;
+    uint32_t* out = Allocate(size);
+    uint32_t* end = out + size;
+    module.Iterate([&](const Instruction& inst) {
+        // Check each instruction fits before writing it, so a stale size can never overflow.
+        TINT_ASSERT(inst.word_length() <= static_cast<size_t>(end - out));
+        out = process_instruction(inst, out);
+    });
+    TINT_ASSERT(out == end);
 }
 
 void BinaryWriter::WriteInstruction(const Instruction& inst) {
-    process_instruction(inst);
+    process_instruction(inst, Allocate(inst.word_length()));
 }
 
 void BinaryWriter::WriteHeader(uint32_t bound, uint32_t version) {
-    out_.push_back(spv::MagicNumber);
-    out_.push_back(0x00010300);  // Version 1.3
-    out_.push_back(kGeneratorId | version);
-    out_.push_back(bound);
-    out_.push_back(0);
+    uint32_t* out = Allocate(5);
+    out[0] = spv::MagicNumber;
+    out[1] = 0x00010300;  // Version 1.3
+    out[2] = kGeneratorId | version;
+    out[3] = bound;
+    out[4] = 0;
+}
+
+uint32_t* BinaryWriter::Allocate(size_t count) {
+    if (sink_) {
+        return sink_->GetSpace(count);
+    }
+    size_t offset = out_.size();
+    out_.resize(offset + count);
+    return out_.data() + offset;
 }
 
-void BinaryWriter::process_instruction(const Instruction& inst) {
-    out_.push_back(inst.word_length() << 16 | static_cast<uint32_t>(inst.opcode()));
+uint32_t* BinaryWriter::process_instruction(const Instruction& inst, uint32_t* out) {
+    *out++ = inst.word_length() << 16 | static_cast<uint32_t>(inst.opcode());
     for (const auto& op : inst.operands()) {
-        process_op(op);
+        out = process_op(op, out);
     }
+    return out;
 }
 
-void BinaryWriter::process_op(const Operand& op) {
+uint32_t* BinaryWriter::process_op(const Operand& op, uint32_t* out) {
     if (auto* i = std::get_if<uint32_t>(&op)) {
-        out_.push_back(*i);
-        return;
+        *out++ = *i;
+        return out;
     }
     if (auto* f = std::get_if<float>(&op)) {
-        // Allocate space for the float
-        out_.push_back(0);
-        uint8_t* ptr = reinterpret_cast<uint8_t*>(out_.data() + (out_.size() - 1));
-        memcpy(ptr, f, 4);
-        return;
+        memcpy(out, f, 4);
+        return out + 1;
     }
     if (auto* str = std::get_if<std::string>(&op)) {
-        auto idx = out_.size();
-        out_.resize(out_.size() + OperandLength(op), 0);
-        memcpy(out_.data() + idx, str->c_str(), str->size() + 1);
-        return;
+        // Zero the last word, as the words may be uninitialized and the string is zero padded.
+        auto length = OperandLength(op);
+        out[length - 1] = 0;
+        memcpy(out, str->c_str(), str->size() + 1);
+        return out + length;
     }
+    return out;
 }
 
 }  // namespace tint::spirv::writer
@@ -31,14 +31,20 @@
 #include <vector>
 
 #include "src/tint/lang/spirv/writer/common/module.h"
+#include "src/tint/lang/spirv/writer/common/word_sink.h"
 
 namespace tint::spirv::writer {
 
 /// Writer to convert from module to SPIR-V binary.
 class BinaryWriter {
   public:
-    /// Constructor
+    /// Constructor. The SPIR-V is accumulated into the vector returned by Result().
     BinaryWriter();
+
+    /// Constructor. The SPIR-V is written directly into @p sink, and Result() remains empty.
+    /// @param sink the sink to write the SPIR-V words into
+    explicit BinaryWriter(WordSink& sink);
+
     ~BinaryWriter();
 
     /// Writes the SPIR-V header.
@@ -62,9 +68,13 @@ class BinaryWriter {
     std::vector<uint32_t>& Result() { return out_; }
 
   private:
-    void process_instruction(const Instruction& inst);
-    void process_op(const Operand& op);
+    /// @returns a pointer to @p count newly allocated words at the end of the output
+    uint32_t* Allocate(size_t count);
+
+    uint32_t* process_instruction(const Instruction& inst, uint32_t* out);
+    uint32_t* process_op(const Operand& op, uint32_t* out);
 
+    WordSink* sink_ = nullptr;
     std::vector<uint32_t> out_;
 };
 
@@ -26,6 +26,10 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "src/tint/lang/spirv/writer/common/binary_writer.h"
+
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace tint::spirv::writer {
@@ -136,5 +140,99 @@ TEST_F(SpirvWriterBinaryWriterTest, TestInstructionWriter) {
     EXPECT_EQ(res[3], 4u);
 }
 
+/// A WordSink that appends words to a vector, and records the size of each allocation.
+class VectorSink : public WordSink {
+  public:
+    uint32_t* GetSpace(size_t count) override {
+        allocations.push_back(count);
+        size_t offset = words.size();
+        // Fill with a non-zero pattern, to check that all the allocated words are written.
+        words.resize(offset + count, 0xcdcdcdcd);
+        return words.data() + offset;
+    }
+
+    std::vector<uint32_t> words;
+    std::vector<size_t> allocations;
+};
+
+TEST_F(SpirvWriterBinaryWriterTest, Sink_MatchesResult) {
+    Module m;
+    m.PushCapability(1);
+    m.PushExtension("my_extension");
+    m.PushAnnot(spv::Op::OpKill, {Operand(2u), Operand(2.4f), Operand("my_string")});
+    m.PushType(spv::Op::OpKill, {Operand("mystring")});
+
+    BinaryWriter bw;
+    bw.WriteHeader(5);
+    bw.WriteModule(m);
+
+    VectorSink sink;
+    BinaryWriter sink_bw{sink};
+    sink_bw.WriteHeader(5);
+    sink_bw.WriteModule(m);
+
+    EXPECT_TRUE(sink_bw.Result().empty());
+    EXPECT_EQ(sink.words, bw.Result());
+
+    // One allocation for the header, and one for the entire module.
+    EXPECT_EQ(sink.allocations, (std::vector<size_t>{5, m.TotalSize() - 5}));
+}
+
+TEST_F(SpirvWriterBinaryWriterTest, Function) {
+    Module m;
+    m.PushType(spv::Op::OpTypeVoid, {Operand(1u)});
+    Instruction decl{spv::Op::OpFunction, {Operand(1u), Operand(2u), Operand(0u), Operand(3u)}};
+    Instruction param{spv::Op::OpFunctionParameter, {Operand(1u), Operand(5u)}};
+    Function f{decl, Operand(4u), {param}};
+    f.push_var({Operand(6u), Operand(7u), Operand(8u)});
+    f.push_inst(spv::Op::OpReturn, {});
+    m.PushFunction(f);
+
+    // Header + OpTypeVoid + OpFunction + OpFunctionParameter + OpLabel + OpVariable + OpReturn +
+    // OpFunctionEnd
+    EXPECT_EQ(m.TotalSize(), 5u + 2u + 5u + 3u + 2u + 4u + 1u + 1u);
+
+    BinaryWriter bw;
+    bw.WriteHeader(9);
+    bw.WriteModule(m);
+
+    auto& res = bw.Result();
+    ASSERT_EQ(res.size(), m.TotalSize());
+    EXPECT_EQ(res[7], 5u << 16 | static_cast<uint32_t>(spv::Op::OpFunction));
+    EXPECT_EQ(res[12], 3u << 16 | static_cast<uint32_t>(spv::Op::OpFunctionParameter));
+    EXPECT_EQ(res[15], 2u << 16 | static_cast<uint32_t>(spv::Op::OpLabel));
+    EXPECT_EQ(res[16], 4u);
+    EXPECT_EQ(res[17], 4u << 16 | static_cast<uint32_t>(spv::Op::OpVariable));
+    EXPECT_EQ(res[21], 1u << 16 | static_cast<uint32_t>(spv::Op::OpReturn));
+    EXPECT_EQ(res[22], 1u << 16 | static_cast<uint32_t>(spv::Op::OpFunctionEnd));
+
+    VectorSink sink;
+    BinaryWriter sink_bw{sink};
+    sink_bw.WriteHeader(9);
+    sink_bw.WriteModule(m);
+    EXPECT_EQ(sink.words, res);
+    EXPECT_EQ(sink.allocations, (std::vector<size_t>{5, m.TotalSize() - 5}));
+}
+
+TEST_F(SpirvWriterBinaryWriterTest, Sink_Instruction) {
+    Instruction i1{spv::Op::OpKill, {Operand(2u)}};
+    Instruction i2{spv::Op::OpKill, {Operand("my_string")}};
+
+    VectorSink sink;
+    BinaryWriter bw{sink};
+    bw.WriteInstruction(i1);
+    bw.WriteInstruction(i2);
+
+    ASSERT_EQ(sink.words.size(), 6u);
+    EXPECT_EQ(sink.words[0], 2u << 16 | static_cast<uint32_t>(spv::Op::OpKill));
+    EXPECT_EQ(sink.words[1], 2u);
+    EXPECT_EQ(sink.words[2], 4u << 16 | static_cast<uint32_t>(spv::Op::OpKill));
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(sink.words.data() + 3)), "my_string");
+    auto* padding = reinterpret_cast<const uint8_t*>(sink.words.data() + 3) + 10;
+    EXPECT_EQ(padding[0], 0u);
+    EXPECT_EQ(padding[1], 0u);
+    EXPECT_EQ(sink.allocations, (std::vector<size_t>{2, 4}));
+}
+
 }  // namespace
 }  // namespace tint::spirv::writer
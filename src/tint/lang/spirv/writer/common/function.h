@@ -87,8 +87,8 @@ class Function {
 
     /// @returns the word length of the function
     uint32_t word_length() const {
-        // 1 for the Label and 1 for the FunctionEnd
-        uint32_t size = 2 + declaration_.word_length();
+        // 2 for the Label and 1 for the FunctionEnd
+        uint32_t size = 3 + declaration_.word_length();
 
         for (const auto& param : params_) {
             size += param.word_length();
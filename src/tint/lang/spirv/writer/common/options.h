@@ -31,6 +31,7 @@
 #include <unordered_map>
 
 #include "src/tint/api/common/binding_point.h"
+#include "src/tint/api/options/ir_passes.h"
 #include "src/tint/utils/reflection/reflection.h"
 
 namespace tint::spirv::writer {
@@ -159,6 +160,9 @@ struct Options {
     /// Set to `true` to disable the polyfills on integer division and modulo.
     bool disable_polyfill_integer_div_mod = false;
 
+    /// Options for the IR passes that raise the module to the SPIR-V dialect
+    IRPassOptions ir_passes = {};
+
     /// Reflect the fields of this class so that it can be used by tint::ForeachField()
     TINT_REFLECT(Options,
                  bindings,
@@ -173,7 +177,8 @@ struct Options {
                  pass_matrix_by_pointer,
                  experimental_require_subgroup_uniform_control_flow,
                  polyfill_dot_4x8_packed,
-                 disable_polyfill_integer_div_mod);
+                 disable_polyfill_integer_div_mod,
+                 ir_passes);
 };
 
 }  // namespace tint::spirv::writer
@@ -32,6 +32,8 @@
 #include <string>
 #include <vector>
 
+#include "src/tint/api/options/ir_passes.h"
+
 namespace tint::spirv::writer {
 
 /// The output produced when generating SPIR-V.
@@ -51,6 +53,9 @@ struct Output {
 
     /// The generated SPIR-V.
     std::vector<uint32_t> spirv;
+
+    /// The statistics of each IR pass, if Options::ir_passes requested them.
+    std::vector<IRPassStats> ir_pass_stats;
 };
 
 }  // namespace tint::spirv::writer
@@ -200,6 +200,21 @@ class Printer {
         return std::move(writer.Result());
     }
 
+    /// Generates the SPIR-V code, writing the words directly into @p sink.
+    /// @param sink the sink to write the SPIR-V words into
+    /// @returns success or failure
+    Result<SuccessType> Code(WordSink& sink) {
+        if (auto res = Generate(); res != Success) {
+            return res.Failure();
+        }
+
+        // Serialize the module into binary SPIR-V.
+        BinaryWriter writer{sink};
+        writer.WriteHeader(module_.IdBound(), kWriterVersion);
+        writer.WriteModule(module_);
+        return Success;
+    }
+
     /// @returns the generated SPIR-V module on success, or failure
     Result<writer::Module> Module() {
         if (auto res = Generate(); res != Success) {
@@ -2280,6 +2295,12 @@ tint::Result<std::vector<uint32_t>> Print(core::ir::Module& module,
     return Printer{module, zero_init_workgroup_memory}.Code();
 }
 
+tint::Result<SuccessType> Print(core::ir::Module& module,
+                                bool zero_init_workgroup_memory,
+                                WordSink& sink) {
+    return Printer{module, zero_init_workgroup_memory}.Code(sink);
+}
+
 tint::Result<Module> PrintModule(core::ir::Module& module, bool zero_init_workgroup_memory) {
     return Printer{module, zero_init_workgroup_memory}.Module();
 }
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "src/tint/lang/spirv/writer/common/module.h"
+#include "src/tint/lang/spirv/writer/common/word_sink.h"
 #include "src/tint/utils/result/result.h"
 
 // Forward declarations
@@ -48,6 +49,16 @@ namespace tint::spirv::writer {
 tint::Result<std::vector<uint32_t>> Print(core::ir::Module& module,
                                           bool zero_init_workgroup_memory);
 
+/// Generates the SPIR-V for @p module, writing the words directly into @p sink.
+/// @returns success or failure
+/// @param module the Tint IR module to generate
+/// @param zero_init_workgroup_memory `true` to initialize all the variables in the Workgroup
+///                                   storage class with OpConstantNull
+/// @param sink the sink to write the SPIR-V words into
+tint::Result<SuccessType> Print(core::ir::Module& module,
+                                bool zero_init_workgroup_memory,
+                                WordSink& sink);
+
 /// @returns the generated SPIR-V module on success, or failure
 /// @param module the Tint IR module to generate
 /// @param zero_init_workgroup_memory `true` to initialize all the variables in the Workgroup
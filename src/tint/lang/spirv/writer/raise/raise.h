@@ -29,6 +29,7 @@
 #define SRC_TINT_LANG_SPIRV_WRITER_RAISE_RAISE_H_
 
 #include <string>
+#include <vector>
 
 #include "src/tint/lang/spirv/writer/common/options.h"
 #include "src/tint/utils/diagnostic/diagnostic.h"
@@ -44,8 +45,12 @@ namespace tint::spirv::writer {
 /// Raise a core IR module to the SPIR-V dialect of the IR.
 /// @param module the core IR module to raise to SPIR-V dialect
 /// @param options the SPIR-V writer options
+/// @param pass_stats if not null, the statistics of each IR pass are written to this vector when
+/// `options.ir_passes.collect_stats` is set
 /// @returns success or failure
-Result<SuccessType> Raise(core::ir::Module& module, const Options& options);
+Result<SuccessType> Raise(core::ir::Module& module,
+                          const Options& options,
+                          std::vector<IRPassStats>* pass_stats = nullptr);
 
 }  // namespace tint::spirv::writer
 
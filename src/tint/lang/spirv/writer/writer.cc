@@ -29,6 +29,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "src/tint/lang/spirv/writer/ast_printer/ast_printer.h"
 #include "src/tint/lang/spirv/writer/common/option_helpers.h"
@@ -39,22 +40,35 @@
 #include "spirv/unified1/spirv.h"
 
 namespace tint::spirv::writer {
+namespace {
+
+/// Validates the options and raises @p ir from the core dialect to the SPIR-V dialect.
+/// @param ir the IR module
+/// @param options the configuration options
+/// @param pass_stats if not null, receives the statistics of the IR passes
+/// @returns success or failure
+Result<SuccessType> Prepare(core::ir::Module& ir,
+                            const Options& options,
+                            std::vector<IRPassStats>* pass_stats = nullptr) {
+    if (auto res = ValidateBindingOptions(options); res != Success) {
+        return res.Failure();
+    }
+
+    // Raise from core-dialect to SPIR-V-dialect.
+    if (auto res = Raise(ir, options, pass_stats); res != Success) {
+        return std::move(res.Failure());
+    }
+    return Success;
+}
+
+}  // namespace
 
 Result<Output> Generate(core::ir::Module& ir, const Options& options) {
     bool zero_initialize_workgroup_memory =
         !options.disable_workgroup_init && options.use_zero_initialize_workgroup_memory_extension;
 
-    {
-        auto res = ValidateBindingOptions(options);
-        if (res != Success) {
-            return res.Failure();
-        }
-    }
-
     Output output;
-
-    // Raise from core-dialect to SPIR-V-dialect.
-    if (auto res = Raise(ir, options); res != Success) {
+    if (auto res = Prepare(ir, options, &output.ir_pass_stats); res != Success) {
         return std::move(res.Failure());
     }
 
@@ -68,6 +82,18 @@ Result<Output> Generate(core::ir::Module& ir, const Options& options) {
     return output;
 }
 
+Result<SuccessType> Generate(core::ir::Module& ir, const Options& options, WordSink& sink) {
+    bool zero_initialize_workgroup_memory =
+        !options.disable_workgroup_init && options.use_zero_initialize_workgroup_memory_extension;
+
+    if (auto res = Prepare(ir, options); res != Success) {
+        return std::move(res.Failure());
+    }
+
+    // Generate the SPIR-V code directly into the sink.
+    return Print(ir, zero_initialize_workgroup_memory, sink);
+}
+
 Result<Output> Generate(const Program& program, const Options& options) {
     if (!program.IsValid()) {
         return Failure{program.Diagnostics()};
@@ -32,6 +32,7 @@
 
 #include "src/tint/lang/core/ir/module.h"
 #include "src/tint/lang/spirv/writer/common/options.h"
+#include "src/tint/lang/spirv/writer/common/word_sink.h"
 #include "src/tint/lang/spirv/writer/output.h"
 #include "src/tint/utils/diagnostic/diagnostic.h"
 #include "src/tint/utils/result/result.h"
@@ -50,6 +51,16 @@ namespace tint::spirv::writer {
 /// @returns the resulting SPIR-V and supplementary information, or failure.
 Result<Output> Generate(core::ir::Module& ir, const Options& options);
 
+/// Generate SPIR-V for a program, according to a set of configuration options, writing the SPIR-V
+/// directly into a caller-provided sink. Unlike the Generate() overloads that return an Output,
+/// the SPIR-V is not built in an intermediate vector.
+/// @param ir the IR module to translate to SPIR-V
+/// @param options the configuration options to use when generating SPIR-V
+/// @param sink the sink to write the SPIR-V words into. On failure the sink may hold a partial
+///             module.
+/// @returns success or failure
+Result<SuccessType> Generate(core::ir::Module& ir, const Options& options, WordSink& sink);
+
 /// Generate SPIR-V for a program, according to a set of configuration options.
 /// The result will contain the SPIR-V or failure.
 /// @param program the program to translate to SPIR-V
@@ -28,6 +28,7 @@
 #include "src/tint/lang/spirv/writer/common/helper_test.h"
 
 #include "gmock/gmock.h"
+#include "src/tint/lang/spirv/writer/writer.h"
 
 namespace tint::spirv::writer {
 namespace {
@@ -40,6 +41,34 @@ TEST_F(SpirvWriterTest, ModuleHeader) {
     EXPECT_INST("OpMemoryModel Logical GLSL450");
 }
 
+TEST_F(SpirvWriterTest, GenerateIntoSink) {
+    /// A WordSink that appends words to a vector.
+    class VectorSink : public WordSink {
+      public:
+        uint32_t* GetSpace(size_t count) override {
+            size_t offset = words.size();
+            words.resize(offset + count);
+            return words.data() + offset;
+        }
+        std::vector<uint32_t> words;
+    };
+
+    auto* func = b.Function("foo", ty.u32());
+    b.Append(func->Block(), [&] {  //
+        b.Return(func, 42_u);
+    });
+
+    VectorSink sink;
+    auto res = writer::Generate(mod, Options{}, sink);
+    ASSERT_EQ(res, Success) << res.Failure().reason.Str();
+    ASSERT_GT(sink.words.size(), 5u);
+    EXPECT_EQ(sink.words[0], spv::MagicNumber);
+    EXPECT_TRUE(Validate(sink.words)) << err_;
+
+    auto disassembly = Disassemble(sink.words, SPV_BINARY_TO_TEXT_OPTION_FRIENDLY_NAMES);
+    EXPECT_THAT(disassembly, testing::HasSubstr("OpReturnValue %uint_42"));
+}
+
 TEST_F(SpirvWriterTest, Unreachable) {
     auto* func = b.Function("foo", ty.void_());
     b.Append(func->Block(), [&] {
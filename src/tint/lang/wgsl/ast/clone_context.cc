@@ -43,7 +43,7 @@ Symbol CloneContext::Clone(Symbol s) {
         if (symbol_transform_) {
             return symbol_transform_(s);
         }
-        return dst->Symbols().New(s.Name());
+        return dst->Symbols().New(s.NameView());
     });
 }
 
@@ -31,7 +31,6 @@
 
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
-#include "src/tint/lang/wgsl/resolver/resolve.h"
 #include "src/tint/lang/wgsl/sem/module.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::ast::transform::DisableUniformityAnalysis);
@@ -42,20 +41,14 @@ DisableUniformityAnalysis::DisableUniformityAnalysis() = default;
 
 DisableUniformityAnalysis::~DisableUniformityAnalysis() = default;
 
-Transform::ApplyResult DisableUniformityAnalysis::Apply(const Program& src,
-                                                        const DataMap&,
-                                                        DataMap&) const {
-    if (src.Sem().Module()->Extensions().Contains(
+bool DisableUniformityAnalysis::Fuse(program::CloneContext& ctx, const DataMap&, DataMap&) const {
+    if (ctx.src->Sem().Module()->Extensions().Contains(
             wgsl::Extension::kChromiumDisableUniformityAnalysis)) {
-        return SkipTransform;
+        return false;
     }
 
-    ProgramBuilder b;
-    program::CloneContext ctx{&b, &src, /* auto_clone_symbols */ true};
-    b.Enable(wgsl::Extension::kChromiumDisableUniformityAnalysis);
-
-    ctx.Clone();
-    return resolver::Resolve(b);
+    ctx.dst->Enable(wgsl::Extension::kChromiumDisableUniformityAnalysis);
+    return true;
 }
 
 }  // namespace tint::ast::transform
@@ -33,17 +33,16 @@
 namespace tint::ast::transform {
 
 /// Disable uniformity analysis for the program.
-class DisableUniformityAnalysis final : public Castable<DisableUniformityAnalysis, Transform> {
+class DisableUniformityAnalysis final
+    : public Castable<DisableUniformityAnalysis, FusibleTransform> {
   public:
     /// Constructor
     DisableUniformityAnalysis();
     /// Destructor
     ~DisableUniformityAnalysis() override;
 
-    /// @copydoc Transform::Apply
-    ApplyResult Apply(const Program& program,
-                      const DataMap& inputs,
-                      DataMap& outputs) const override;
+    /// @copydoc FusibleTransform::Fuse
+    bool Fuse(program::CloneContext& ctx, const DataMap& inputs, DataMap& outputs) const override;
 };
 
 }  // namespace tint::ast::transform
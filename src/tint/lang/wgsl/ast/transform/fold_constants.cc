@@ -36,7 +36,6 @@
 #include "src/tint/lang/core/type/bool.h"
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
-#include "src/tint/lang/wgsl/resolver/resolve.h"
 #include "src/tint/utils/rtti/switch.h"
 
 using namespace tint::core::fluent_types;  // NOLINT
@@ -85,50 +84,43 @@ struct State {
             TINT_ICE_ON_NO_MATCH);
     }
 
-    Transform::ApplyResult Run() {
-        ctx.ReplaceAll([&](const Expression* expr) -> const Expression* {
-            auto& sem = ctx.src->Sem();
-            auto* ve = sem.Get<sem::ValueExpression>(expr);
-
-            // No value expression SEM node found
-            if (!ve) {
-                return nullptr;
-            }
+    program::CloneContext& ctx;
+    ProgramBuilder& b = *ctx.dst;
+};
 
-            auto* cv = ve->ConstantValue();
+}  // namespace
 
-            // No constant value for this expression
-            if (!cv) {
-                return nullptr;
-            }
+FoldConstants::FoldConstants() = default;
 
-            if (cv->Type()->HoldsAbstract() && !cv->Type()->is_float_scalar() &&
-                !cv->Type()->is_signed_integer_scalar() &&
-                !cv->Type()->is_unsigned_integer_scalar()) {
-                return nullptr;
-            }
+FoldConstants::~FoldConstants() = default;
 
-            return Constant(cv);
-        });
+bool FoldConstants::Fuse(program::CloneContext& ctx, const DataMap&, DataMap&) const {
+    ctx.ReplaceAll([&ctx](const Expression* expr) -> const Expression* {
+        auto& sem = ctx.src->Sem();
+        auto* ve = sem.Get<sem::ValueExpression>(expr);
 
-        ctx.Clone();
-        return resolver::Resolve(b);
-    }
+        // No value expression SEM node found
+        if (!ve) {
+            return nullptr;
+        }
 
-    const Program& src;
-    ProgramBuilder b;
-    program::CloneContext ctx{&b, &src, /* auto_clone_symbols */ true};
-};
+        auto* cv = ve->ConstantValue();
 
-}  // namespace
+        // No constant value for this expression
+        if (!cv) {
+            return nullptr;
+        }
 
-FoldConstants::FoldConstants() = default;
+        if (cv->Type()->HoldsAbstract() && !cv->Type()->is_float_scalar() &&
+            !cv->Type()->is_signed_integer_scalar() &&
+            !cv->Type()->is_unsigned_integer_scalar()) {
+            return nullptr;
+        }
 
-FoldConstants::~FoldConstants() = default;
+        return State{ctx}.Constant(cv);
+    });
 
-Transform::ApplyResult FoldConstants::Apply(const Program& src, const DataMap&, DataMap&) const {
-    State s{src, {}};
-    return s.Run();
+    return true;
 }
 
 }  // namespace tint::ast::transform
@@ -30,6 +30,7 @@
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
 #include "src/tint/lang/wgsl/resolver/resolve.h"
+#include "src/tint/utils/containers/vector.h"
 
 /// If set to 1 then the transform::Manager will dump the WGSL of the program
 /// before and after each transform. Helpful for debugging bad output.
@@ -43,6 +44,35 @@
 #endif  // TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM
 
 namespace tint::ast::transform {
+namespace {
+
+/// Applies the fusible transforms @p transforms to @p program with a single CloneContext.
+/// @param transforms the consecutive fusible transforms to apply, in order
+/// @param program the input program
+/// @param inputs optional extra transform-specific input data
+/// @param outputs optional extra transform-specific output data
+/// @returns the transformed program, or SkipTransform if none of the transforms needed to run.
+Transform::ApplyResult ApplyFused(VectorRef<const FusibleTransform*> transforms,
+                                  const Program& program,
+                                  const DataMap& inputs,
+                                  DataMap& outputs) {
+    ProgramBuilder b;
+    program::CloneContext ctx{&b, &program, /* auto_clone_symbols */ true};
+    bool changed = false;
+    for (auto* transform : transforms) {
+        if (transform->Fuse(ctx, inputs, outputs)) {
+            changed = true;
+        }
+    }
+    if (!changed) {
+        return Transform::SkipTransform;
+    }
+
+    ctx.Clone();
+    return resolver::Resolve(b);
+}
+
+}  // namespace
 
 Manager::Manager() = default;
 Manager::~Manager() = default;
@@ -72,17 +102,38 @@ Program Manager::Run(const Program& program_in, const DataMap& inputs, DataMap&
 
     TINT_IF_PRINT_PROGRAM(print_program("Input of", nullptr));
 
-    for (const auto& transform : transforms_) {
-        if (auto result = transform->Apply(*program, inputs, outputs)) {
+    for (size_t i = 0; i < transforms_.size();) {
+        // Consecutive fusible transforms share a single clone and resolve of the program.
+        Vector<const FusibleTransform*, 4> fused;
+        for (size_t j = i; j < transforms_.size(); j++) {
+            if (auto* fusible = transforms_[j]->As<FusibleTransform>()) {
+                fused.Push(fusible);
+            } else {
+                break;
+            }
+        }
+
+        const Transform* transform = transforms_[i].get();
+        Transform::ApplyResult result;
+        if (fused.Length() > 1) {
+            result = ApplyFused(fused, *program, inputs, outputs);
+            transform = fused.Back();
+            i += fused.Length();
+        } else {
+            result = transform->Apply(*program, inputs, outputs);
+            i++;
+        }
+
+        if (result) {
             output.emplace(std::move(result.value()));
             program = &output.value();
 
             if (!program->IsValid()) {
-                TINT_IF_PRINT_PROGRAM(print_program("Invalid output of", transform.get()));
+                TINT_IF_PRINT_PROGRAM(print_program("Invalid output of", transform));
                 break;
             }
 
-            TINT_IF_PRINT_PROGRAM(print_program("Output of", transform.get()));
+            TINT_IF_PRINT_PROGRAM(print_program("Output of", transform));
         } else {
             TINT_IF_PRINT_PROGRAM(std::cout << "Skipped " << transform->TypeInfo().name
                                             << std::endl);
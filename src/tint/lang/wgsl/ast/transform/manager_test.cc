@@ -28,6 +28,7 @@
 #include "src/tint/lang/wgsl/ast/transform/manager.h"
 
 #include <string>
+#include <utility>
 
 #include "gtest/gtest.h"
 #include "src/tint/lang/wgsl/ast/transform/transform.h"
@@ -56,6 +57,23 @@ class AST_AddFunction final : public ast::transform::Transform {
     }
 };
 
+class AST_FusibleNoOp final : public ast::transform::FusibleTransform {
+    bool Fuse(program::CloneContext&, const DataMap&, DataMap&) const override { return false; }
+};
+
+class AST_FusibleAddFunction final : public ast::transform::FusibleTransform {
+  public:
+    explicit AST_FusibleAddFunction(std::string name) : name_(std::move(name)) {}
+
+    bool Fuse(program::CloneContext& ctx, const DataMap&, DataMap&) const override {
+        ctx.dst->Func(ctx.dst->Sym(name_), {}, ctx.dst->ty.void_(), {});
+        return true;
+    }
+
+  private:
+    std::string name_;
+};
+
 Program MakeAST() {
     ProgramBuilder b;
     b.Func(b.Sym("main"), {}, b.ty.void_(), {});
@@ -77,5 +95,43 @@ TEST_F(TransformManagerTest, AST_AlwaysClone) {
     EXPECT_EQ(result.AST().Functions()[0]->name->symbol.Name(), "main");
 }
 
+// Test that consecutive fusible transforms are all applied.
+TEST_F(TransformManagerTest, AST_Fused) {
+    Program ast = MakeAST();
+
+    Manager manager;
+    DataMap outputs;
+    manager.Add<AST_FusibleAddFunction>("a");
+    manager.Add<AST_FusibleNoOp>();
+    manager.Add<AST_FusibleAddFunction>("b");
+    manager.Add<AST_AddFunction>();
+    manager.Add<AST_FusibleAddFunction>("c");
+
+    auto result = manager.Run(ast, {}, outputs);
+    EXPECT_TRUE(result.IsValid()) << result.Diagnostics();
+    ASSERT_EQ(result.AST().Functions().Length(), 5u);
+    EXPECT_EQ(result.AST().Functions()[0]->name->symbol.Name(), "c");
+    EXPECT_EQ(result.AST().Functions()[1]->name->symbol.Name(), "ast_func");
+    EXPECT_EQ(result.AST().Functions()[2]->name->symbol.Name(), "a");
+    EXPECT_EQ(result.AST().Functions()[3]->name->symbol.Name(), "b");
+    EXPECT_EQ(result.AST().Functions()[4]->name->symbol.Name(), "main");
+}
+
+// Test that an AST program is always cloned, even if all fused transforms are skipped.
+TEST_F(TransformManagerTest, AST_FusedAlwaysClone) {
+    Program ast = MakeAST();
+
+    Manager manager;
+    DataMap outputs;
+    manager.Add<AST_FusibleNoOp>();
+    manager.Add<AST_FusibleNoOp>();
+
+    auto result = manager.Run(ast, {}, outputs);
+    EXPECT_TRUE(result.IsValid()) << result.Diagnostics();
+    EXPECT_NE(result.ID(), ast.ID());
+    ASSERT_EQ(result.AST().Functions().Length(), 1u);
+    EXPECT_EQ(result.AST().Functions()[0]->name->symbol.Name(), "main");
+}
+
 }  // namespace
 }  // namespace tint::ast::transform
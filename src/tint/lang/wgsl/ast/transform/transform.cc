@@ -46,6 +46,7 @@
 using namespace tint::core::fluent_types;  // NOLINT
 
 TINT_INSTANTIATE_TYPEINFO(tint::ast::transform::Transform);
+TINT_INSTANTIATE_TYPEINFO(tint::ast::transform::FusibleTransform);
 
 namespace tint::ast::transform {
 
@@ -67,6 +68,22 @@ Output Transform::Run(const Program& src, const DataMap& data /* = {} */) const
     return output;
 }
 
+FusibleTransform::FusibleTransform() = default;
+FusibleTransform::~FusibleTransform() = default;
+
+Transform::ApplyResult FusibleTransform::Apply(const Program& src,
+                                               const DataMap& inputs,
+                                               DataMap& outputs) const {
+    ProgramBuilder b;
+    program::CloneContext ctx{&b, &src, /* auto_clone_symbols */ true};
+    if (!Fuse(ctx, inputs, outputs)) {
+        return SkipTransform;
+    }
+
+    ctx.Clone();
+    return resolver::Resolve(b);
+}
+
 void Transform::RemoveStatement(program::CloneContext& ctx, const Statement* stmt) {
     auto* sem = ctx.src->Sem().Get(stmt);
     if (auto* block = tint::As<sem::BlockStatement>(sem->Parent())) {
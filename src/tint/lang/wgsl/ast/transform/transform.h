@@ -112,6 +112,37 @@ class Transform : public Castable<Transform> {
     static void RemoveStatement(program::CloneContext& ctx, const Statement* stmt);
 };
 
+/// Interface for transforms that can share a single clone of the program with other transforms.
+/// A FusibleTransform registers its changes with a CloneContext instead of cloning and resolving
+/// the program itself. The Manager applies a run of consecutive FusibleTransforms with a single
+/// CloneContext, cloning and resolving the program once for the whole run.
+/// Fuse() must only inspect `ctx.src`, as it will not observe the changes made by other transforms
+/// sharing the same CloneContext, and must not register replacements that could overlap with those
+/// of another fusible transform.
+class FusibleTransform : public Castable<FusibleTransform, Transform> {
+  public:
+    /// Constructor
+    FusibleTransform();
+    /// Destructor
+    ~FusibleTransform() override;
+
+    /// Registers the changes of this transform with @p ctx. Must not call `ctx.Clone()`.
+    /// @param ctx the clone context shared with the other fused transforms
+    /// @param inputs optional extra transform-specific input data
+    /// @param outputs optional extra transform-specific output data
+    /// @returns true if the transform registered any changes, or false if the transform did not
+    /// need to be run. Fuse() must not modify @p ctx if it returns false.
+    virtual bool Fuse(program::CloneContext& ctx,
+                      const DataMap& inputs,
+                      DataMap& outputs) const = 0;
+
+    /// Runs the transform on its own, by calling Fuse() with a new CloneContext.
+    /// @copydoc Transform::Apply
+    ApplyResult Apply(const Program& program,
+                      const DataMap& inputs,
+                      DataMap& outputs) const override;
+};
+
 }  // namespace tint::ast::transform
 
 #endif  // SRC_TINT_LANG_WGSL_AST_TRANSFORM_TRANSFORM_H_
@@ -1124,6 +1124,64 @@ TEST_F(WgslIntrinsicTableTest, OverloadResolution) {
     EXPECT_EQ(result->parameters[0].type, ai);
 }
 
+TEST_F(WgslIntrinsicTableTest, RepeatedLookup) {
+    auto* f32 = create<core::type::F32>();
+    auto* vec3f = create<core::type::Vector>(f32, 3u);
+    auto first = table.Lookup(wgsl::BuiltinFn::kDot, Empty, Vector{vec3f, vec3f},
+                              core::EvaluationStage::kConstant);
+    auto second = table.Lookup(wgsl::BuiltinFn::kDot, Empty, Vector{vec3f, vec3f},
+                               core::EvaluationStage::kConstant);
+    ASSERT_EQ(first, Success);
+    ASSERT_EQ(second, Success);
+    EXPECT_EQ(first.Get(), second.Get());
+    EXPECT_EQ(second->return_type, f32);
+    EXPECT_NE(second->const_eval_fn, nullptr);
+}
+
+TEST_F(WgslIntrinsicTableTest, RepeatedLookup_DifferentEvaluationStage) {
+    // The evaluation stage is part of the lookup signature, so a cached constant-stage overload
+    // must not be returned for a runtime-stage lookup.
+    auto* ai = create<core::type::AbstractInt>();
+    auto* u32 = create<core::type::U32>();
+    auto constant =
+        table.Lookup(core::BinaryOp::kShiftLeft, ai, u32, core::EvaluationStage::kConstant, false);
+    auto runtime =
+        table.Lookup(core::BinaryOp::kShiftLeft, ai, u32, core::EvaluationStage::kRuntime, false);
+    ASSERT_EQ(constant, Success);
+    ASSERT_EQ(runtime, Success);
+    EXPECT_EQ(constant->return_type, ai);
+    EXPECT_TRUE(runtime->return_type->Is<core::type::I32>());
+}
+
+TEST_F(WgslIntrinsicTableTest, RepeatedLookup_Mismatch) {
+    // Failed lookups are not cached, and report the same error each time.
+    auto* f32 = create<core::type::F32>();
+    auto* bool_ = create<core::type::Bool>();
+    for (int i = 0; i < 2; i++) {
+        auto result =
+            table.Lookup(core::BinaryOp::kMultiply, f32, bool_, core::EvaluationStage::kConstant,
+                         /* is_compound */ i == 1);
+        ASSERT_NE(result, Success);
+        EXPECT_THAT(result.Failure().Plain(), HasSubstr(i == 1 ? "'operator *= (f32, bool)'"
+                                                               : "'operator * (f32, bool)'"));
+    }
+}
+
+TEST_F(WgslIntrinsicTableTest, RepeatedLookup_TemplateArgs) {
+    // Template arguments are part of the lookup signature.
+    auto* i32 = create<core::type::I32>();
+    auto* u32 = create<core::type::U32>();
+    auto* ai = create<core::type::AbstractInt>();
+    auto as_i32 = table.Lookup(CtorConv::kVec3, Vector{i32}, Vector{ai, ai, ai},
+                               core::EvaluationStage::kConstant);
+    auto as_u32 = table.Lookup(CtorConv::kVec3, Vector{u32}, Vector{ai, ai, ai},
+                               core::EvaluationStage::kConstant);
+    ASSERT_EQ(as_i32, Success);
+    ASSERT_EQ(as_u32, Success);
+    EXPECT_EQ(as_i32->return_type, create<core::type::Vector>(i32, 3u));
+    EXPECT_EQ(as_u32->return_type, create<core::type::Vector>(u32, 3u));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // AbstractBinaryTests
 ////////////////////////////////////////////////////////////////////////////////
@@ -25,9 +25,16 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
 #include "src/tint/lang/wgsl/ls/server.h"
 
 #include "src/tint/lang/wgsl/reader/reader.h"
+#include "src/tint/utils/text/unicode.h"
 
 namespace lsp = langsvr::lsp;
 
@@ -35,17 +42,81 @@ namespace tint::wgsl::ls {
 
 namespace {
 
-/// @returns the byte offsets of the start of all the lines in @p str.
-std::vector<size_t> LineOffsets(std::string_view str) {
-    std::vector<size_t> offsets;
-    offsets.push_back(0);
-    for (size_t i = 0, n = str.length(); i < n; i++) {
-        if (str[i] == '\n') {
-            offsets.push_back(i + 1);
+/// Text holds the utf-8 content of a document while a list of content changes are applied to it.
+/// The byte offsets of the start of each line are patched with each edit, instead of being
+/// re-scanned from the whole document for every change.
+class Text {
+  public:
+    /// Constructor
+    /// @param utf8 the initial content of the document
+    explicit Text(std::string utf8) : utf8_(std::move(utf8)) {
+        line_offsets_.push_back(0);
+        AddLineOffsets(0, utf8_);
+    }
+
+    /// Replaces the text in @p range with @p replacement.
+    /// @param range the zero-based range in utf-16 code points, relative to the current content.
+    /// @param replacement the new utf-8 text
+    void Replace(const lsp::Range& range, std::string_view replacement) {
+        size_t start = Offset(range.start);
+        size_t end = std::max(start, Offset(range.end));
+        utf8_.replace(start, end - start, replacement);
+
+        // Remove the lines that began within the replaced text.
+        auto first = std::upper_bound(line_offsets_.begin(), line_offsets_.end(), start);
+        auto last = std::upper_bound(first, line_offsets_.end(), end);
+        first = line_offsets_.erase(first, last);
+        // Shift the lines that follow the replaced text.
+        for (auto it = first; it != line_offsets_.end(); it++) {
+            *it = *it + replacement.size() - (end - start);
         }
+        // Add the lines introduced by the replacement.
+        AddLineOffsets(start, replacement);
+    }
+
+    /// @returns the current utf-8 content
+    const std::string& Get() const { return utf8_; }
+
+  private:
+    /// Inserts the offsets of the lines that start in @p str, which begins at the byte offset
+    /// @p base.
+    void AddLineOffsets(size_t base, std::string_view str) {
+        std::vector<size_t> offsets;
+        for (size_t i = 0, n = str.length(); i < n; i++) {
+            if (str[i] == '\n') {
+                offsets.push_back(base + i + 1);
+            }
+        }
+        if (!offsets.empty()) {
+            auto at = std::upper_bound(line_offsets_.begin(), line_offsets_.end(), base);
+            line_offsets_.insert(at, offsets.begin(), offsets.end());
+        }
+    }
+
+    /// @returns the utf-8 byte offset of the zero-based utf-16 position @p pos
+    size_t Offset(const lsp::Position& pos) const {
+        if (pos.line >= line_offsets_.size()) {
+            return utf8_.size();
+        }
+        size_t offset = line_offsets_[pos.line];
+        size_t line_end =
+            pos.line + 1 < line_offsets_.size() ? line_offsets_[pos.line + 1] - 1 : utf8_.size();
+        // Convert utf-16 code points -> utf-8 code points
+        for (langsvr::lsp::Uinteger i = 0; i < pos.character && offset < line_end;) {
+            auto [code_point, n] =
+                utf8::Decode(std::string_view(utf8_).substr(offset, line_end - offset));
+            if (n == 0) {
+                break;
+            }
+            offset += n;
+            i += utf16::Encode(code_point, nullptr);
+        }
+        return offset;
     }
-    return offsets;
-}
+
+    std::string utf8_;
+    std::vector<size_t> line_offsets_;
+};
 
 }  // namespace
 
@@ -72,17 +143,21 @@ langsvr::Result<langsvr::SuccessType> Server::Handle(
         return langsvr::Failure{"document not found"};
     }
 
-    auto utf8 = (*file)->source->content.data;
+    Text text{(*file)->source->content.data};
     for (auto& change : n.content_changes) {
         if (auto* edit = change.Get<lsp::TextDocumentContentChangePartial>()) {
-            auto range = (*file)->Conv(edit->range);
-            std::vector<size_t> line_offsets = LineOffsets(utf8);
-            size_t utf8_start = line_offsets[range.begin.line - 1] + range.begin.column - 1;
-            size_t utf8_end = line_offsets[range.end.line - 1] + range.end.column - 1;
-            utf8 = utf8.substr(0, utf8_start) + edit->text + utf8.substr(utf8_end);
+            text.Replace(edit->range, edit->text);
         }
     }
-    auto source = std::make_unique<Source::File>(n.text_document.uri, utf8);
+
+    if (text.Get() == (*file)->source->content.data) {
+        // The content is unchanged (for example, an undo that reverted an edit). The existing
+        // program is still valid, so skip the re-parse and re-resolve.
+        (*file)->version = n.text_document.version;
+        return PublishDiagnostics(**file);
+    }
+
+    auto source = std::make_unique<Source::File>(n.text_document.uri, text.Get());
     auto program = wgsl::reader::Parse(source.get());
     *file = std::make_shared<File>(std::move(source), n.text_document.version, std::move(program));
     return PublishDiagnostics(**file);
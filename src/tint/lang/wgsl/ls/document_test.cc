@@ -0,0 +1,161 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "langsvr/lsp/lsp.h"
+#include "langsvr/lsp/primitives.h"
+#include "langsvr/lsp/printer.h"
+#include "src/tint/lang/wgsl/ls/helpers_test.h"
+
+namespace tint::wgsl::ls {
+namespace {
+
+namespace lsp = langsvr::lsp;
+
+/// A single edit of a TextDocumentDidChangeNotification
+struct Edit {
+    lsp::Range range;
+    std::string text;
+};
+
+class LsDocumentTest : public LsTest {
+  protected:
+    /// Sends a TextDocumentDidChangeNotification holding @p edits for the document @p uri.
+    /// @returns the diagnostics published by the server in response to the change
+    std::vector<lsp::Diagnostic> Change(const std::string& uri, std::vector<Edit> edits) {
+        lsp::TextDocumentDidChangeNotification notification{};
+        notification.text_document.uri = uri;
+        notification.text_document.version = ++version_;
+        for (auto& edit : edits) {
+            lsp::TextDocumentContentChangePartial change{};
+            change.range = edit.range;
+            change.text = std::move(edit.text);
+            notification.content_changes.push_back(std::move(change));
+        }
+        size_t count = diagnostics_.Length();
+        auto res = client_session_.Send(notification);
+        EXPECT_EQ(res, langsvr::Success);
+        EXPECT_EQ(diagnostics_.Length(), count + 1);
+        if (diagnostics_.Length() != count + 1) {
+            return {};
+        }
+        EXPECT_EQ(diagnostics_.Back().uri, uri);
+        return diagnostics_.Back().diagnostics;
+    }
+
+    /// @returns an error diagnostic with the message @p msg and the range @p range
+    static lsp::Diagnostic Error(std::string_view msg, lsp::Range range) {
+        lsp::Diagnostic d;
+        d.message = msg;
+        d.range = range;
+        d.severity = lsp::DiagnosticSeverity::kError;
+        return d;
+    }
+
+    lsp::Integer version_ = 0;
+};
+
+TEST_F(LsDocumentTest, SingleEdit) {
+    auto uri = OpenDocument("const a = b;");
+    EXPECT_THAT(Change(uri, {{{{0, 10}, {0, 11}}, "cd"}}),
+                testing::ElementsAre(Error("unresolved value 'cd'", {{0, 10}, {0, 12}})));
+}
+
+TEST_F(LsDocumentTest, MultipleEditsInOneChange) {
+    // Each edit's range is relative to the text after the previous edits have been applied.
+    auto uri = OpenDocument("const a = b;\nconst c = d;\n");
+    EXPECT_THAT(Change(uri,
+                       {
+                           {{{0, 10}, {0, 11}}, "xyz"},  // const a = xyz;
+                           {{{0, 11}, {0, 13}}, ""},     // const a = x;
+                           {{{1, 10}, {1, 11}}, "1"},    // const c = 1;
+                           {{{0, 11}, {0, 11}}, "w"},    // const a = xw;
+                       }),
+                testing::ElementsAre(Error("unresolved value 'xw'", {{0, 10}, {0, 12}})));
+}
+
+TEST_F(LsDocumentTest, EditInsertsLines) {
+    auto uri = OpenDocument("const a = 1;\nconst b = c;\n");
+    EXPECT_THAT(Change(uri,
+                       {
+                           {{{0, 12}, {0, 12}}, "\nconst d = 2;\nconst e = 3;"},
+                           // 'c' is now on the fourth line.
+                           {{{3, 10}, {3, 11}}, "k"},
+                       }),
+                testing::ElementsAre(Error("unresolved value 'k'", {{3, 10}, {3, 11}})));
+}
+
+TEST_F(LsDocumentTest, EditRemovesLines) {
+    auto uri = OpenDocument("const a = 1;\nconst b = 2;\nconst c = 3;\nconst d = e;\n");
+    EXPECT_THAT(Change(uri,
+                       {
+                           // Replace from the '1' on the first line to the 'e' on the last line.
+                           {{{0, 10}, {3, 10}}, "f"},
+                       }),
+                testing::ElementsAre(Error("unresolved value 'fe'", {{0, 10}, {0, 12}})));
+    EXPECT_THAT(Change(uri,
+                       {
+                           {{{0, 13}, {0, 13}}, "\nconst g = h;"},
+                           // The line added by the first edit is removed by the second.
+                           {{{0, 10}, {1, 10}}, "i"},
+                       }),
+                testing::ElementsAre(Error("unresolved value 'ih'", {{0, 10}, {0, 12}})));
+}
+
+TEST_F(LsDocumentTest, Utf16Columns) {
+    // U+1F600 is outside of the Basic Multilingual Plane, so it is 2 utf-16 code units and 4 utf-8
+    // bytes. 'b' is at utf-16 column 19.
+    auto uri = OpenDocument(
+        "/* \xF0\x9F\x98\x80 */ const a = b;\n/* \xF0\x9F\x98\x80 */ const z = 1;\n");
+    EXPECT_THAT(Change(uri,
+                       {
+                           {{{0, 19}, {0, 20}}, "\xF0\x9F\x98\x80 */ ee"},
+                           {{{0, 19}, {0, 19}}, "/* "},
+                           // Join the lines, removing the comment that holds a non-BMP character.
+                           {{{0, 31}, {1, 9}}, ""},
+                       }),
+                testing::ElementsAre(Error("unresolved value 'ee'", {{0, 28}, {0, 30}})));
+}
+
+TEST_F(LsDocumentTest, UnchangedContent) {
+    auto uri = OpenDocument("const a = b;");
+    EXPECT_THAT(Change(uri,
+                       {
+                           {{{0, 10}, {0, 11}}, "c"},
+                           {{{0, 10}, {0, 11}}, "b"},
+                       }),
+                testing::ElementsAre(Error("unresolved value 'b'", {{0, 10}, {0, 11}})));
+}
+
+}  // namespace
+}  // namespace tint::wgsl::ls
@@ -25,6 +25,10 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
+#include <optional>
+#include <vector>
+
 #include "langsvr/lsp/comparators.h"
 #include "langsvr/lsp/lsp.h"
 #include "langsvr/lsp/primitives.h"
@@ -82,34 +86,43 @@ std::optional<SemToken::Kind> TokenKindFor(const sem::Expression* expr) {
         [](tint::Default) { return std::nullopt; });
 }
 
-/// @returns all the semantic tokens in the file @p file, in sequential order.
-std::vector<Token> Tokens(File& file) {
+/// @returns the semantic tokens in the file @p file, in sequential order.
+/// If @p range is provided, then only the tokens that overlap @p range are returned.
+std::vector<Token> Tokens(File& file, std::optional<Source::Range> range = std::nullopt) {
     std::vector<Token> tokens;
     auto& sem = file.program.Sem();
+    auto add = [&](const tint::Source::Range& source, SemToken::Kind kind) {
+        if (!range || (source.begin < range->end && source.end > range->begin)) {
+            tokens.push_back(TokenFromRange(file, source, kind));
+        }
+    };
     for (auto* node : file.nodes) {
+        if (range) {
+            // File::nodes is sorted by start location, so no following node can hold a token
+            // within the range.
+            if (node->source.range.begin >= range->end) {
+                break;
+            }
+            // Nodes enclose the identifiers of their tokens.
+            if (node->source.range.end < range->begin) {
+                continue;
+            }
+        }
         Switch(
             node,  //
             [&](const ast::IdentifierExpression* expr) {
                 if (auto kind = TokenKindFor(sem.Get(expr))) {
-                    tokens.push_back(TokenFromRange(file, expr->identifier->source.range, *kind));
+                    add(expr->identifier->source.range, *kind);
                 }
             },
-            [&](const ast::Struct* str) {
-                tokens.push_back(TokenFromRange(file, str->name->source.range, SemToken::kType));
-            },
+            [&](const ast::Struct* str) { add(str->name->source.range, SemToken::kType); },
             [&](const ast::StructMember* member) {
-                tokens.push_back(
-                    TokenFromRange(file, member->name->source.range, SemToken::kMember));
-            },
-            [&](const ast::Variable* var) {
-                tokens.push_back(
-                    TokenFromRange(file, var->name->source.range, SemToken::kVariable));
-            },
-            [&](const ast::Function* fn) {
-                tokens.push_back(TokenFromRange(file, fn->name->source.range, SemToken::kFunction));
+                add(member->name->source.range, SemToken::kMember);
             },
+            [&](const ast::Variable* var) { add(var->name->source.range, SemToken::kVariable); },
+            [&](const ast::Function* fn) { add(fn->name->source.range, SemToken::kFunction); },
             [&](const ast::MemberAccessorExpression* a) {
-                tokens.push_back(TokenFromRange(file, a->member->source.range, SemToken::kMember));
+                add(a->member->source.range, SemToken::kMember);
             });
     }
     std::sort(tokens.begin(), tokens.end(),
@@ -118,6 +131,25 @@ std::vector<Token> Tokens(File& file) {
     return tokens;
 }
 
+/// @returns the tokens @p tokens encoded as relative positions, as described by:
+/// https://microsoft.github.io/language-server-protocol/specifications/lsp/3.17/specification/#textDocument_semanticTokens
+lsp::SemanticTokens Encode(const std::vector<Token>& tokens) {
+    lsp::SemanticTokens out;
+    Token last;
+    for (auto tok : tokens) {
+        if (last.position.line != tok.position.line) {
+            last.position.character = 0;
+        }
+        out.data.push_back(tok.position.line - last.position.line);
+        out.data.push_back(tok.position.character - last.position.character);
+        out.data.push_back(tok.length);
+        out.data.push_back(static_cast<langsvr::lsp::Uinteger>(tok.kind));
+        out.data.push_back(0);  // modifiers
+        last = tok;
+    }
+    return out;
+}
+
 }  // namespace
 
 typename lsp::TextDocumentSemanticTokensFullRequest::ResultType  //
@@ -125,24 +157,18 @@ Server::Handle(const lsp::TextDocumentSemanticTokensFullRequest& r) {
     typename lsp::TextDocumentSemanticTokensFullRequest::SuccessType result;
 
     if (auto file = files_.Get(r.text_document.uri)) {
-        lsp::SemanticTokens out;
-        // https://microsoft.github.io/language-server-protocol/specifications/lsp/3.17/specification/#textDocument_semanticTokens
-        Token last;
-
-        auto tokens = Tokens(**file);
-        for (auto tok : tokens) {
-            if (last.position.line != tok.position.line) {
-                last.position.character = 0;
-            }
-            out.data.push_back(tok.position.line - last.position.line);
-            out.data.push_back(tok.position.character - last.position.character);
-            out.data.push_back(tok.length);
-            out.data.push_back(static_cast<langsvr::lsp::Uinteger>(tok.kind));
-            out.data.push_back(0);  // modifiers
-            last = tok;
-        }
+        result = Encode(Tokens(**file));
+    }
 
-        result = out;
+    return result;
+}
+
+typename lsp::TextDocumentSemanticTokensRangeRequest::ResultType  //
+Server::Handle(const lsp::TextDocumentSemanticTokensRangeRequest& r) {
+    typename lsp::TextDocumentSemanticTokensRangeRequest::SuccessType result;
+
+    if (auto file = files_.Get(r.text_document.uri)) {
+        result = Encode(Tokens(**file, (*file)->Conv(r.range)));
     }
 
     return result;
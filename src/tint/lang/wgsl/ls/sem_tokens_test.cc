@@ -65,6 +65,32 @@ std::ostream& operator<<(std::ostream& stream, const RangeAndToken& rt) {
     return stream << "\n" << SemToken::kNames[rt.token] << ": " << rt.range;
 }
 
+/// @returns the tokens decoded from @p tokens
+/// https://microsoft.github.io/language-server-protocol/specifications/lsp/3.17/specification/#textDocument_semanticTokens
+std::vector<RangeAndToken> Decode(const lsp::SemanticTokens& tokens) {
+    auto& data = tokens.data;
+    EXPECT_EQ(data.size() % 5, 0u);
+    lsp::Position pos{};
+    std::vector<RangeAndToken> got;
+    for (size_t i = 0; i + 5 <= data.size(); i += 5) {
+        const auto delta_line = data[i + 0];
+        const auto delta_start = data[i + 1];
+        const auto length = data[i + 2];
+        const auto token_type = data[i + 3];
+        const auto modifiers = data[i + 4];
+
+        pos.line += delta_line;
+        pos.character = (delta_line == 0) ? (pos.character + delta_start) : delta_start;
+        lsp::Range range;
+        range.start = pos;
+        range.end = lsp::Position{pos.line, pos.character + length};
+        auto token = static_cast<SemToken::Kind>(token_type);
+        EXPECT_EQ(modifiers, 0u);
+        got.push_back(RangeAndToken{range, token});
+    }
+    return got;
+}
+
 using LsSemTokensTest = LsTestWithParam<Case>;
 TEST_P(LsSemTokensTest, SemTokens) {
     auto parsed = ParseMarkers(GetParam().markup);
@@ -93,27 +119,7 @@ TEST_P(LsSemTokensTest, SemTokens) {
         for (size_t i = 0; i < parsed.ranges.size(); i++) {
             expect.push_back(RangeAndToken{parsed.ranges[i], GetParam().tokens[i]});
         }
-        // https://microsoft.github.io/language-server-protocol/specifications/lsp/3.17/specification/#textDocument_semanticTokens
-        auto& data = res.Get<lsp::SemanticTokens>()->data;
-        ASSERT_EQ(data.size() % 5, 0u);
-        lsp::Position pos{};
-        std::vector<RangeAndToken> got;
-        for (size_t i = 0; i < data.size(); i += 5) {
-            const auto delta_line = data[i + 0];
-            const auto delta_start = data[i + 1];
-            const auto length = data[i + 2];
-            const auto token_type = data[i + 3];
-            const auto modifiers = data[i + 4];
-
-            pos.line += delta_line;
-            pos.character = (delta_line == 0) ? (pos.character + delta_start) : delta_start;
-            lsp::Range range;
-            range.start = pos;
-            range.end = lsp::Position{pos.line, pos.character + length};
-            auto token = static_cast<SemToken::Kind>(token_type);
-            ASSERT_EQ(modifiers, 0u);
-            got.push_back(RangeAndToken{range, token});
-        }
+        auto got = Decode(*res.Get<lsp::SemanticTokens>());
         EXPECT_EQ(got, expect);
     }
 }
@@ -273,5 +279,44 @@ fn「f」() {
                              },
                          }));
 
+TEST_F(LsTest, SemTokensRange) {
+    auto parsed = ParseMarkers(R"(
+fn「f」() { let i = 1; _ = i; }
+fn「g」() { let「j」= 2; _ =「j」; }
+fn h() { let k = 3; _ = k; }
+)");
+    ASSERT_EQ(parsed.ranges.size(), 4u);
+
+    lsp::TextDocumentSemanticTokensRangeRequest req{};
+    req.text_document.uri = OpenDocument(parsed.clean);
+
+    {
+        // All of the second line.
+        req.range = lsp::Range{lsp::Position{2, 0}, lsp::Position{3, 0}};
+        auto future = client_session_.Send(req);
+        ASSERT_EQ(future, langsvr::Success);
+        auto res = future->get();
+        ASSERT_TRUE(res.Is<lsp::SemanticTokens>());
+        std::vector<RangeAndToken> expect{
+            RangeAndToken{parsed.ranges[1], SemToken::kFunction},
+            RangeAndToken{parsed.ranges[2], SemToken::kVariable},
+            RangeAndToken{parsed.ranges[3], SemToken::kVariable},
+        };
+        EXPECT_EQ(Decode(*res.Get<lsp::SemanticTokens>()), expect);
+    }
+    {
+        // The start of the first line, which partially covers the declaration of 'f'.
+        req.range = lsp::Range{lsp::Position{1, 0}, lsp::Position{1, 4}};
+        auto future = client_session_.Send(req);
+        ASSERT_EQ(future, langsvr::Success);
+        auto res = future->get();
+        ASSERT_TRUE(res.Is<lsp::SemanticTokens>());
+        std::vector<RangeAndToken> expect{
+            RangeAndToken{parsed.ranges[0], SemToken::kFunction},
+        };
+        EXPECT_EQ(Decode(*res.Get<lsp::SemanticTokens>()), expect);
+    }
+}
+
 }  // namespace
 }  // namespace tint::wgsl::ls
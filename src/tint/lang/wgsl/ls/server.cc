@@ -70,6 +70,7 @@ Server::Server(langsvr::Session& session) : session_(session) {
         result.capabilities.semantic_tokens_provider = [] {
             lsp::SemanticTokensOptions opts;
             opts.full = true;
+            opts.range = true;
             for (auto name : SemToken::kNames) {
                 opts.legend.token_types.push_back(name);
             }
@@ -108,6 +109,8 @@ Server::Server(langsvr::Session& session) : session_(session) {
     session.Register([&](const lsp::TextDocumentRenameRequest& r) { return Handle(r); });
     session.Register(
         [&](const lsp::TextDocumentSemanticTokensFullRequest& r) { return Handle(r); });
+    session.Register(
+        [&](const lsp::TextDocumentSemanticTokensRangeRequest& r) { return Handle(r); });
     session.Register([&](const lsp::TextDocumentSignatureHelpRequest& r) { return Handle(r); });
     session.Register(
         [&](const lsp::WorkspaceDidChangeWatchedFilesNotification& n) { return Handle(n); });
@@ -127,6 +127,10 @@ class Server {
     typename langsvr::lsp::TextDocumentSemanticTokensFullRequest::ResultType  //
     Handle(const langsvr::lsp::TextDocumentSemanticTokensFullRequest&);
 
+    /// Handler for langsvr::lsp::TextDocumentSemanticTokensRangeRequest
+    typename langsvr::lsp::TextDocumentSemanticTokensRangeRequest::ResultType  //
+    Handle(const langsvr::lsp::TextDocumentSemanticTokensRangeRequest&);
+
     /// Handler for langsvr::lsp::WorkspaceDidChangeConfigurationNotification
     langsvr::Result<langsvr::SuccessType>  //
     Handle(const langsvr::lsp::WorkspaceDidChangeConfigurationNotification&);
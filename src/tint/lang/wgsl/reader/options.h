@@ -28,6 +28,8 @@
 #ifndef SRC_TINT_LANG_WGSL_READER_OPTIONS_H_
 #define SRC_TINT_LANG_WGSL_READER_OPTIONS_H_
 
+#include <cstdint>
+
 #include "src/tint/lang/wgsl/common/allowed_features.h"
 #include "src/tint/utils/reflection/reflection.h"
 
@@ -38,8 +40,16 @@ struct Options {
     /// The extensions and language features that are allowed to be used.
     AllowedFeatures allowed_features{};
 
+    /// The maximum number of threads used by the uniformity analysis.
+    uint32_t max_uniformity_analysis_threads = 1;
+
+    /// If true, then parsing and resolving stop at the first error, and the diagnostics that only
+    /// elaborate on an error (warnings, notes and lists of candidate overloads) are not built.
+    /// Use this when only the validity of the program matters.
+    bool fast_fail = false;
+
     /// Reflect the fields of this class so that it can be used by tint::ForeachField().
-    TINT_REFLECT(Options, allowed_features);
+    TINT_REFLECT(Options, allowed_features, max_uniformity_analysis_threads, fast_fail);
 };
 
 }  // namespace tint::wgsl::reader
@@ -28,12 +28,64 @@
 #ifndef SRC_TINT_LANG_WGSL_READER_PARSER_CLASSIFY_TEMPLATE_ARGS_H_
 #define SRC_TINT_LANG_WGSL_READER_PARSER_CLASSIFY_TEMPLATE_ARGS_H_
 
+#include <cstddef>
+#include <limits>
 #include <vector>
 
 #include "src/tint/lang/wgsl/reader/parser/token.h"
+#include "src/tint/utils/containers/vector.h"
 
 namespace tint::wgsl::reader {
 
+/// TemplateArgumentClassifier incrementally reclassifies '<' and '>' tokens that form template
+/// argument lists as kTemplateArgsLeft and kTemplateArgsRight, splitting '>>', '>=' and '>>='
+/// tokens where necessary.
+///
+/// Tokens are fed to Classify() in order. A token is only finalized once it has been passed to
+/// Classify() and it is not at or after FirstPendingIndex(), as a pending '<' may still be
+/// reclassified by a later '>'.
+class TemplateArgumentClassifier {
+  public:
+    /// Classifies the token @p token, which must be immediately followed by @p next.
+    /// @param token the token to classify. This must remain at a stable address while it is
+    /// pending.
+    /// @param next the token that immediately follows @p token
+    /// @param index the index of @p token in the token stream
+    void Classify(Token& token, Token& next, size_t index);
+
+    /// Classifies any remaining tokens as not forming template argument lists. Must be called once
+    /// all the tokens have been passed to Classify().
+    void Finalize();
+
+    /// @returns the index of the earliest '<' token that may still be reclassified as a
+    /// kTemplateArgsLeft, or std::numeric_limits<size_t>::max() if there are no pending tokens.
+    size_t FirstPendingIndex() const {
+        return stack_.IsEmpty() ? std::numeric_limits<size_t>::max() : stack_.Front().index;
+    }
+
+  private:
+    /// A pending '<' token.
+    struct StackEntry {
+        Token* token;         // A pointer to the opening '<' token
+        size_t index;         // The index of the opening '<' token
+        uint64_t expr_depth;  // The value of 'expr_depth' for the opening '<'
+    };
+
+    // The current expression nesting depth.
+    // Each '(', '[' increments the depth.
+    // Each ')', ']' decrements the depth.
+    uint64_t expr_depth_ = 0;
+
+    // A stack of '<' tokens.
+    // Used to pair '<' and '>' tokens at the same expression depth.
+    Vector<StackEntry, 16> stack_;
+
+    // True if the next token passed to Classify() is a '<' that was already pushed to the stack.
+    bool skip_next_ = false;
+};
+
+/// Classifies all the template argument lists in @p tokens.
+/// @param tokens the list of tokens, terminated by an EOF or error token
 void ClassifyTemplateArguments(std::vector<Token>& tokens);
 
 }  // namespace tint::wgsl::reader
@@ -25,6 +25,10 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
+#include <deque>
+#include <vector>
+
 #include "gmock/gmock.h"
 
 #include "src/tint/lang/wgsl/reader/parser/classify_template_args.h"
@@ -57,6 +61,35 @@ TEST_P(WGSLParserClassifyTemplateArgsTest, Classify) {
     EXPECT_THAT(types, testing::ContainerEq(params.tokens));
 }
 
+TEST_P(WGSLParserClassifyTemplateArgsTest, ClassifyIncremental) {
+    auto& params = GetParam();
+    Source::File file("", params.wgsl);
+    Lexer l(&file);
+    std::deque<Token> tokens;
+    TemplateArgumentClassifier classifier;
+    size_t num_classified = 0;
+    bool more = true;
+    while (more) {
+        more = l.LexNext(tokens);
+        for (; num_classified + 1 < tokens.size(); num_classified++) {
+            classifier.Classify(tokens[num_classified], tokens[num_classified + 1], num_classified);
+        }
+        // Tokens before the first pending token must already have their final type.
+        size_t num_final = std::min(num_classified, classifier.FirstPendingIndex());
+        for (size_t i = 0; i < num_final; i++) {
+            ASSERT_LT(i, params.tokens.size());
+            EXPECT_EQ(tokens[i].type(), params.tokens[i]) << "token " << i;
+        }
+    }
+    classifier.Finalize();
+
+    std::vector<T> types;
+    for (auto& t : tokens) {
+        types.push_back(t.type());
+    }
+    EXPECT_THAT(types, testing::ContainerEq(params.tokens));
+}
+
 INSTANTIATE_TEST_SUITE_P(NonTemplate,
                          WGSLParserClassifyTemplateArgsTest,
                          testing::ValuesIn(std::vector<Case>{
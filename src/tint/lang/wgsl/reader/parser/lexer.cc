@@ -86,6 +86,58 @@ bool read_blankspace(std::string_view str,
     return true;
 }
 
+/// @returns true if `c` is an ASCII character that can start an identifier
+/// (an ASCII XID_Start character or an underscore).
+inline bool is_ascii_ident_start(uint8_t c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+/// @returns true if `c` is an ASCII XID_Continue character.
+inline bool is_ascii_ident_continue(uint8_t c) {
+    return is_ascii_ident_start(c) || (c >= '0' && c <= '9');
+}
+
+/// @returns the number of consecutive ASCII blankspace characters (space and horizontal tab) in
+/// `str`, starting at `i`.
+size_t count_ascii_blankspace(std::string_view str, size_t i) {
+    size_t start = i;
+    while (i < str.size() && (str[i] == ' ' || str[i] == '\t')) {
+        i++;
+    }
+    return i - start;
+}
+
+/// @returns the number of consecutive ASCII XID_Continue characters in `str`, starting at `i`.
+/// The scan stops at the first non-identifier or non-ASCII byte, so the caller only needs to fall
+/// back to UTF-8 decoding when the returned run is followed by a byte >= 0x80.
+size_t count_ascii_ident_continue(std::string_view str, size_t i) {
+    auto* ptr = reinterpret_cast<const uint8_t*>(str.data());
+    size_t start = i;
+    while (i < str.size() && is_ascii_ident_continue(ptr[i])) {
+        i++;
+    }
+    return i - start;
+}
+
+/// Appends @p token to @p tokens. If the token can be split, then placeholder element(s) are also
+/// appended to the list to hold the split character.
+/// @returns false if the token was an EOF or error token, otherwise true
+template <typename TOKEN_LIST>
+bool AppendToken(TOKEN_LIST& tokens, Token&& token) {
+    auto& t = tokens.emplace_back(std::move(token));
+    if (t.IsEof() || t.IsError()) {
+        return false;
+    }
+
+    size_t num_placeholders = t.NumPlaceholders();
+    for (size_t i = 0; i < num_placeholders; i++) {
+        auto src = tokens.back().source();
+        src.range.begin.column++;
+        tokens.emplace_back(Token::Type::kPlaceholder, src);
+    }
+    return true;
+}
+
 uint32_t dec_value(char c) {
     if (c >= '0' && c <= '9') {
         return static_cast<uint32_t>(c - '0');
@@ -116,24 +168,15 @@ std::vector<Token> Lexer::Lex() {
     std::vector<Token> tokens;
     tokens.reserve(kDefaultListSize);
 
-    while (true) {
-        tokens.emplace_back(next());
-        if (tokens.back().IsEof() || tokens.back().IsError()) {
-            break;
-        }
-
-        // If the token can be split, we insert a placeholder element(s) into the stream to hold the
-        // split character.
-        size_t num_placeholders = tokens.back().NumPlaceholders();
-        for (size_t i = 0; i < num_placeholders; i++) {
-            auto src = tokens.back().source();
-            src.range.begin.column++;
-            tokens.emplace_back(Token::Type::kPlaceholder, src);
-        }
+    while (AppendToken(tokens, next())) {
     }
     return tokens;
 }
 
+bool Lexer::LexNext(std::deque<Token>& tokens) {
+    return AppendToken(tokens, next());
+}
+
 std::string_view Lexer::line() const {
     if (file_->content.lines.size() == 0) {
         static const char* empty_string = "";
@@ -191,24 +234,33 @@ Token Lexer::next() {
         return std::move(t.value());
     }
 
-    if (auto t = try_hex_float(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
+    // Numeric literals always start with a digit or '.', and identifiers always start with a
+    // letter, an underscore or a non-ASCII code point, so only try the matchers that can succeed
+    // for the first byte.
+    auto c = static_cast<uint8_t>(at(pos()));
 
-    if (auto t = try_hex_integer(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
+    if (is_digit(static_cast<char>(c)) || c == '.') {
+        if (auto t = try_hex_float(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
 
-    if (auto t = try_float(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
+        if (auto t = try_hex_integer(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
 
-    if (auto t = try_integer(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
+        if (auto t = try_float(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
+
+        if (auto t = try_integer(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
     }
 
-    if (auto t = try_ident(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
+    if (c >= 0x80 || is_ascii_ident_start(c)) {
+        if (auto t = try_ident(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
     }
 
     if (auto t = try_punctuation(); t.has_value() && !t->IsUninitialized()) {
@@ -265,6 +317,12 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
                 continue;
             }
 
+            // Fast path: skip runs of ASCII blankspace without decoding UTF-8.
+            if (auto n = count_ascii_blankspace(line(), pos()); n > 0) {
+                advance(static_cast<uint32_t>(n));
+                continue;
+            }
+
             bool is_blankspace;
             uint32_t blankspace_size;
             if (!read_blankspace(line(), pos(), &is_blankspace, &blankspace_size)) {
@@ -298,12 +356,12 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
 std::optional<Token> Lexer::skip_comment() {
     if (matches(pos(), "//")) {
         // Line comment: ignore everything until the end of line.
-        while (!is_eol()) {
-            if (is_null()) {
-                return Token{Token::Type::kError, begin_source(), "null character found"};
-            }
-            advance();
+        auto rest = line().substr(pos());
+        if (auto* null = std::memchr(rest.data(), 0, rest.size())) {
+            advance(static_cast<uint32_t>(static_cast<const char*>(null) - rest.data()));
+            return Token{Token::Type::kError, begin_source(), "null character found"};
         }
+        set_pos(length());
         return {};
     }
 
@@ -318,23 +376,35 @@ std::optional<Token> Lexer::skip_comment() {
 
         int depth = 1;
         while (!is_eof() && depth > 0) {
-            if (matches(pos(), "/*")) {
-                // Start of block comment: increase nesting depth.
-                advance(2);
-                depth++;
-            } else if (matches(pos(), "*/")) {
-                // End of block comment: decrease nesting depth.
-                advance(2);
-                depth--;
-            } else if (is_eol()) {
+            if (is_eol()) {
                 // Newline: skip and update source location.
                 advance_line();
-            } else if (is_null()) {
-                return Token{Token::Type::kError, begin_source(), "null character found"};
-            } else {
-                // Anything else: skip and update source location.
-                advance();
+                continue;
+            }
+
+            // Scan the rest of the current line directly, only stopping on the characters that
+            // can change the nesting depth or are invalid.
+            auto l = line();
+            size_t i = pos();
+            while (i < l.size() && depth > 0) {
+                char c = l[i];
+                if (c == '/' && i + 1 < l.size() && l[i + 1] == '*') {
+                    // Start of block comment: increase nesting depth.
+                    i += 2;
+                    depth++;
+                } else if (c == '*' && i + 1 < l.size() && l[i + 1] == '/') {
+                    // End of block comment: decrease nesting depth.
+                    i += 2;
+                    depth--;
+                } else if (c == 0) {
+                    set_pos(static_cast<uint32_t>(i));
+                    return Token{Token::Type::kError, begin_source(), "null character found"};
+                } else {
+                    // Anything else: skip.
+                    i++;
+                }
             }
+            set_pos(static_cast<uint32_t>(i));
         }
         if (depth > 0) {
             return Token{Token::Type::kError, source, "unterminated block comment"};
@@ -984,14 +1054,20 @@ std::optional<Token> Lexer::try_ident() {
     auto start = pos();
 
     // Must begin with an XID_Source unicode character, or underscore
-    {
+    if (auto c = static_cast<uint8_t>(at(pos())); c < 0x80) {
+        // ASCII fast path
+        if (!is_ascii_ident_start(c)) {
+            return {};
+        }
+        advance();
+    } else {
         auto* utf8 = reinterpret_cast<const uint8_t*>(&at(pos()));
         auto [code_point, n] = tint::utf8::Decode(utf8, length() - pos());
         if (n == 0) {
             advance();  // Skip the bad byte.
             return Token{Token::Type::kError, source, "invalid UTF-8"};
         }
-        if (code_point != tint::CodePoint('_') && !code_point.IsXIDStart()) {
+        if (!code_point.IsXIDStart()) {
             return {};
         }
         // Consume start codepoint
@@ -999,6 +1075,13 @@ std::optional<Token> Lexer::try_ident() {
     }
 
     while (!is_eol()) {
+        // Consume the run of ASCII identifier characters, only decoding UTF-8 when a non-ASCII
+        // byte is encountered.
+        advance(static_cast<uint32_t>(count_ascii_ident_continue(line(), pos())));
+        if (is_eol() || static_cast<uint8_t>(at(pos())) < 0x80) {
+            break;
+        }
+
         // Must continue with an XID_Continue unicode character
         auto* utf8 = reinterpret_cast<const uint8_t*>(&at(pos()));
         auto [code_point, n] = tint::utf8::Decode(utf8, line().size() - pos());
@@ -1210,6 +1293,11 @@ std::optional<Token> Lexer::try_punctuation() {
 }
 
 std::optional<Token::Type> Lexer::parse_keyword(std::string_view str) {
+    // All keywords are at most 12 characters long, and begin with a lowercase ASCII letter or an
+    // underscore. Reject anything else without comparing against each keyword.
+    if (str.empty() || str.size() > 12 || (str[0] != '_' && (str[0] < 'a' || str[0] > 'z'))) {
+        return std::nullopt;
+    }
     if (str == "alias") {
         return Token::Type::kAlias;
     }
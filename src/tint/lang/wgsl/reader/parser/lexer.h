@@ -28,6 +28,7 @@
 #ifndef SRC_TINT_LANG_WGSL_READER_PARSER_LEXER_H_
 #define SRC_TINT_LANG_WGSL_READER_PARSER_LEXER_H_
 
+#include <deque>
 #include <optional>
 #include <vector>
 
@@ -46,6 +47,13 @@ class Lexer {
     /// @return the token list.
     std::vector<Token> Lex();
 
+    /// Lexes the next token in the input stream, appending it to @p tokens, followed by any
+    /// placeholder tokens required to split it.
+    /// LexNext() must not be called again once it has appended an EOF or error token.
+    /// @param tokens the token list to append to
+    /// @returns false if the appended token was an EOF or error token, otherwise true
+    bool LexNext(std::deque<Token>& tokens);
+
   private:
     /// Returns the next token in the input stream.
     /// @return Token
@@ -696,6 +696,12 @@ INSTANTIATE_TEST_SUITE_P(
                     "\xf0\x9d\x96\x99\xf0\x9d\x96\x8e\xf0\x9d\x96\x8b\xf0\x9d\x96\x8e"
                     "\xf0\x9d\x96\x8a\xf0\x9d\x96\x97\x31\x32\x33",
                     43},
+        UnicodeCase{// "ascii_prefix_𝐢𝐝"
+                    "ascii_prefix_\xf0\x9d\x90\xa2\xf0\x9d\x90\x9d",
+                    21},
+        UnicodeCase{// "ｉｄ_ascii_infix_ｉｄ"
+                    "\xef\xbd\x89\xef\xbd\x84_ascii_infix_\xef\xbd\x89\xef\xbd\x84",
+                    25},
     }));
 
 using InvalidUnicodeIdentifierTest = testing::TestWithParam<const char*>;
@@ -27,6 +27,7 @@
 
 #include "src/tint/lang/wgsl/reader/parser/parser.h"
 
+#include <algorithm>
 #include <limits>
 #include <utility>
 
@@ -269,39 +270,90 @@ void Parser::deprecated(const Source& source, std::string_view msg) {
     }
 }
 
+Token& Parser::token_at(size_t idx) {
+    TINT_ASSERT(idx >= tokens_offset_);
+
+    while (idx >= num_final_ && lex_next()) {
+    }
+
+    if (idx - tokens_offset_ >= tokens_.size()) {
+        // Walked off the end of the token list, return last token.
+        return tokens_.back();
+    }
+    return tokens_[idx - tokens_offset_];
+}
+
+bool Parser::lex_next() {
+    if (lexed_all_) {
+        return false;
+    }
+
+    lexed_all_ = !lexer_->LexNext(tokens_);
+    peak_buffered_tokens_ = std::max(peak_buffered_tokens_, tokens_.size());
+
+    // Classify each token that is followed by another token.
+    size_t num_lexed = tokens_offset_ + tokens_.size();
+    for (; num_classified_ + 1 < num_lexed; num_classified_++) {
+        classifier_.Classify(tokens_[num_classified_ - tokens_offset_],
+                             tokens_[num_classified_ + 1 - tokens_offset_], num_classified_);
+    }
+    if (lexed_all_) {
+        classifier_.Finalize();
+        num_classified_ = num_lexed;
+        num_final_ = num_lexed;
+    } else {
+        // A token is final once the template argument classifier has processed it, and it is not
+        // a '<' that may still be reclassified by a later '>'.
+        num_final_ = std::min(num_classified_, classifier_.FirstPendingIndex());
+    }
+    return true;
+}
+
+void Parser::release_consumed_tokens() {
+    // Keep the token at last_source_idx_, as this is used by last_source().
+    size_t keep = std::min(last_source_idx_, next_token_idx_);
+    while (tokens_offset_ < keep && tokens_.size() > 1) {
+        tokens_.pop_front();
+        tokens_offset_++;
+    }
+}
+
 const Token& Parser::next() {
     // If the next token is already an error or the end of file, stay there.
-    if (tokens_[next_token_idx_].IsEof() || tokens_[next_token_idx_].IsError()) {
-        return tokens_[next_token_idx_];
+    if (auto& t = token_at(next_token_idx_); t.IsEof() || t.IsError()) {
+        return t;
     }
 
     // Skip over any placeholder elements
     while (true) {
-        if (!tokens_[next_token_idx_].IsPlaceholder()) {
+        if (!token_at(next_token_idx_).IsPlaceholder()) {
             break;
         }
         next_token_idx_++;
     }
     last_source_idx_ = next_token_idx_;
 
-    if (!tokens_[next_token_idx_].IsEof() && !tokens_[next_token_idx_].IsError()) {
+    if (auto& t = token_at(next_token_idx_); !t.IsEof() && !t.IsError()) {
         next_token_idx_++;
     }
-    return tokens_[last_source_idx_];
+    return token_at(last_source_idx_);
 }
 
 const Token& Parser::peek(size_t count) {
-    for (size_t idx = next_token_idx_; idx < tokens_.size(); idx++) {
-        if (tokens_[idx].IsPlaceholder()) {
+    for (size_t idx = next_token_idx_;; idx++) {
+        auto& t = token_at(idx);
+        if (t.IsEof() || t.IsError()) {
+            // The last token in the stream.
+            return t;
+        }
+        if (t.IsPlaceholder()) {
             continue;
         }
         if (count == 0) {
-            return tokens_[idx];
+            return t;
         }
         count--;
     }
-    // Walked off the end of the token list, return last token.
-    return tokens_[tokens_.size() - 1];
 }
 
 bool Parser::peek_is(Token::Type tok, size_t idx) {
@@ -312,24 +364,33 @@ void Parser::split_token(Token::Type lhs, Token::Type rhs) {
     if (TINT_UNLIKELY(next_token_idx_ == 0)) {
         TINT_ICE() << "attempt to update placeholder at beginning of tokens";
     }
-    if (TINT_UNLIKELY(next_token_idx_ >= tokens_.size())) {
+    auto& placeholder = token_at(next_token_idx_);
+    if (TINT_UNLIKELY(next_token_idx_ - tokens_offset_ >= tokens_.size())) {
         TINT_ICE() << "attempt to update placeholder past end of tokens";
     }
-    if (TINT_UNLIKELY(!tokens_[next_token_idx_].IsPlaceholder())) {
+    if (TINT_UNLIKELY(!placeholder.IsPlaceholder())) {
         TINT_ICE() << "attempt to update non-placeholder token";
     }
-    tokens_[next_token_idx_ - 1].SetType(lhs);
-    tokens_[next_token_idx_].SetType(rhs);
+    token_at(next_token_idx_ - 1).SetType(lhs);
+    placeholder.SetType(rhs);
 }
 
 Source Parser::last_source() const {
-    return tokens_[last_source_idx_].source();
+    return tokens_[last_source_idx_ - tokens_offset_].source();
 }
 
 void Parser::InitializeLex() {
-    Lexer l{file_};
-    tokens_ = l.Lex();
-    ClassifyTemplateArguments(tokens_);
+    lexer_ = std::make_unique<Lexer>(file_);
+    classifier_ = TemplateArgumentClassifier{};
+    tokens_.clear();
+    tokens_offset_ = 0;
+    num_classified_ = 0;
+    num_final_ = 0;
+    peak_buffered_tokens_ = 0;
+    lexed_all_ = false;
+    next_token_idx_ = 0;
+    last_source_idx_ = 0;
+    lex_next();
 }
 
 bool Parser::Parse() {
@@ -343,6 +404,10 @@ bool Parser::Parse() {
 void Parser::translation_unit() {
     bool after_global_decl = false;
     while (continue_parsing()) {
+        // Drop the tokens of the previous declaration, so that the memory used by the token stream
+        // is bounded by the size of the largest declaration, instead of the size of the file.
+        release_consumed_tokens();
+
         auto& p = peek();
         if (p.IsEof()) {
             break;
@@ -28,6 +28,7 @@
 #ifndef SRC_TINT_LANG_WGSL_READER_PARSER_PARSER_H_
 #define SRC_TINT_LANG_WGSL_READER_PARSER_PARSER_H_
 
+#include <deque>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -37,6 +38,7 @@
 
 #include "src/tint/lang/core/access.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
+#include "src/tint/lang/wgsl/reader/parser/classify_template_args.h"
 #include "src/tint/lang/wgsl/reader/parser/detail.h"
 #include "src/tint/lang/wgsl/reader/parser/token.h"
 #include "src/tint/lang/wgsl/resolver/resolve.h"
@@ -306,8 +308,8 @@ class Parser {
     explicit Parser(Source::File const* file);
     ~Parser();
 
-    /// Reads tokens from the source file. This will be called automatically
-    /// by |parse|.
+    /// Prepares the token stream for reading from the start of the source file. Tokens are lexed
+    /// on demand as the parser reads them. This will be called automatically by |parse|.
     void InitializeLex();
 
     /// Run the parser
@@ -339,6 +341,9 @@ class Parser {
     /// @returns the program builder.
     ProgramBuilder& builder() { return builder_; }
 
+    /// @returns the largest number of tokens held by the parser at any one time
+    size_t peak_buffered_tokens() const { return peak_buffered_tokens_; }
+
     /// @returns the next token
     const Token& next();
     /// Peeks ahead and returns the token at `idx` ahead of the current position
@@ -684,6 +689,18 @@ class Parser {
     /// @return the parsed diagnostic rule name.
     Expect<const ast::DiagnosticRuleName*> expect_diagnostic_rule_name();
 
+    /// Lexes and classifies tokens until the token at `idx` in the token stream is final, or the
+    /// end of the token stream has been reached.
+    /// @param idx the index of the token in the token stream
+    /// @returns the token at `idx`, or the last token if `idx` is past the end of the stream
+    Token& token_at(size_t idx);
+    /// Lexes the next token, and classifies all the tokens that can now be classified.
+    /// @returns false if the end of the token stream has already been reached
+    bool lex_next();
+    /// Releases the tokens that have been consumed by the parser.
+    /// Must only be called when no references to previously returned tokens are held.
+    void release_consumed_tokens();
+
     /// Splits a peekable token into to parts filling in the peekable fields.
     /// @param lhs the token to set in the current position
     /// @param rhs the token to set in the placeholder
@@ -911,7 +928,18 @@ class Parser {
     }
 
     Source::File const* const file_;
-    std::vector<Token> tokens_;
+    std::unique_ptr<Lexer> lexer_;
+    TemplateArgumentClassifier classifier_;
+    /// The window of lexed tokens. tokens_[0] is the token at index `tokens_offset_` in the token
+    /// stream. std::deque is used so that references to tokens remain stable as tokens are added
+    /// and released.
+    std::deque<Token> tokens_;
+    size_t tokens_offset_ = 0;
+    size_t num_classified_ = 0;
+    /// The number of leading tokens in the stream that will not be modified by further lexing.
+    size_t num_final_ = 0;
+    size_t peak_buffered_tokens_ = 0;
+    bool lexed_all_ = false;
     size_t next_token_idx_ = 0;
     size_t last_source_idx_ = 0;
     bool synchronized_ = true;
@@ -69,6 +69,24 @@ fn foo() -> S {
     ASSERT_EQ(1u, program.AST().TypeDecls().Length());
 }
 
+TEST_F(WGSLParserTest, TokenWindowIsBoundedByDeclarationSize) {
+    std::string src;
+    for (int i = 0; i < 1000; i++) {
+        src += "fn f" + std::to_string(i) + "(a : vec4<f32>) -> vec4<f32> {\n";
+        src += "  return a * vec4<f32>(1, 2, 3, 4);\n";
+        src += "}\n";
+    }
+    auto p = parser(src);
+    ASSERT_TRUE(p->Parse()) << p->error();
+
+    Program program = p->program();
+    ASSERT_EQ(1000u, program.AST().Functions().Length());
+
+    // Each function declaration is 36 tokens. Tokens are released after each declaration, so the
+    // parser should never hold more than a couple of declarations worth of tokens.
+    EXPECT_LT(p->peak_buffered_tokens(), 100u);
+}
+
 TEST_F(WGSLParserTest, HandlesError) {
     auto p = parser(R"(
 fn main() ->  {  // missing return type
@@ -46,8 +46,12 @@ Program Parse(const Source::File* file, const Options& options) {
         return Program(std::move(b));
     }
     Parser parser(file);
+    if (options.fast_fail) {
+        parser.set_max_errors(1);
+    }
     parser.Parse();
-    return resolver::Resolve(parser.builder(), options.allowed_features);
+    return resolver::Resolve(parser.builder(), options.allowed_features,
+                             options.max_uniformity_analysis_threads, options.fast_fail);
 }
 
 Result<core::ir::Module> WgslToIR(const Source::File* file, const Options& options) {
@@ -28,6 +28,8 @@
 #include <string>
 
 #include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/wgsl/reader/parser/lexer.h"
+#include "src/tint/lang/wgsl/reader/parser/parser.h"
 #include "src/tint/lang/wgsl/reader/reader.h"
 
 namespace tint::wgsl::reader {
@@ -47,7 +49,59 @@ void ParseWGSL(benchmark::State& state, std::string input_name) {
     }
 }
 
+void LexWGSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    size_t num_tokens = 0;
+    for (auto _ : state) {
+        Lexer lexer(&res.Get());
+        auto tokens = lexer.Lex();
+        if (tokens.back().IsError()) {
+            state.SkipWithError(tokens.back().to_str());
+        }
+        num_tokens += tokens.size();
+    }
+    state.counters["Tokens"] =
+        benchmark::Counter(static_cast<double>(num_tokens), benchmark::Counter::kIsRate);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(res->content.data.size()));
+}
+
+void ParseWGSLTokenMemory(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    // Concatenate 100 copies of the input to build a large module. The declarations will collide,
+    // but this only runs the parser, and not the resolver.
+    std::string content;
+    for (int i = 0; i < 100; i++) {
+        content += res->content.data;
+        content += "\n";
+    }
+    Source::File file(res->path, content);
+
+    size_t peak_tokens = 0;
+    for (auto _ : state) {
+        Parser parser(&file);
+        if (!parser.Parse()) {
+            state.SkipWithError(parser.error());
+        }
+        peak_tokens = parser.peak_buffered_tokens();
+    }
+    state.counters["PeakTokens"] = static_cast<double>(peak_tokens);
+    state.counters["PeakTokenBytes"] = benchmark::Counter(
+        static_cast<double>(peak_tokens * sizeof(Token)), benchmark::Counter::kDefaults,
+        benchmark::Counter::kIs1024);
+}
+
 TINT_BENCHMARK_PROGRAMS(ParseWGSL);
+TINT_BENCHMARK_PROGRAMS(LexWGSL);
+TINT_BENCHMARK_PROGRAMS(ParseWGSLTokenMemory);
 
 }  // namespace
 }  // namespace tint::wgsl::reader
@@ -194,6 +194,17 @@ TEST_F(ResolverBuiltinTest, Select_Error_SelectorInt) {
 )");
 }
 
+TEST_F(ResolverBuiltinTest, Select_Error_SelectorInt_FastFail) {
+    auto* expr = Call("select", 1_i, 1_i, 1_i);
+    WrapInFunction(expr);
+
+    Resolver resolver(this, wgsl::AllowedFeatures::Everything(), 1, /* fast_fail */ true);
+    EXPECT_FALSE(resolver.Resolve());
+
+    EXPECT_EQ(resolver.error(), R"(error: no matching call to 'select(i32, i32, i32)'
+)");
+}
+
 TEST_F(ResolverBuiltinTest, Select_Error_Matrix) {
     auto* expr =
         Call("select", Call<mat2x2<f32>>(Call<vec2<f32>>(1_f, 1_f), Call<vec2<f32>>(1_f, 1_f)),
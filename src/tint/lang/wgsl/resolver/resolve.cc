@@ -33,8 +33,12 @@
 
 namespace tint::resolver {
 
-Program Resolve(ProgramBuilder& builder, const wgsl::AllowedFeatures& allowed_features) {
-    Resolver resolver(&builder, std::move(allowed_features));
+Program Resolve(ProgramBuilder& builder,
+                const wgsl::AllowedFeatures& allowed_features,
+                size_t max_uniformity_analysis_threads,
+                bool fast_fail) {
+    Resolver resolver(&builder, std::move(allowed_features), max_uniformity_analysis_threads,
+                      fast_fail);
     resolver.Resolve();
     return Program(std::move(builder));
 }
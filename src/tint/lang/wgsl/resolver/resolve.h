@@ -28,6 +28,8 @@
 #ifndef SRC_TINT_LANG_WGSL_RESOLVER_RESOLVE_H_
 #define SRC_TINT_LANG_WGSL_RESOLVER_RESOLVE_H_
 
+#include <cstddef>
+
 #include "src/tint/lang/wgsl/common/allowed_features.h"
 
 namespace tint {
@@ -39,10 +41,16 @@ namespace tint::resolver {
 
 /// Performs semantic analysis and validation on the program builder @p builder
 /// @param allowed_features the extensions and features that are allowed to be used
+/// @param max_uniformity_analysis_threads the maximum number of threads used by the uniformity
+/// analysis
+/// @param fast_fail if true, then only the diagnostics needed to determine whether the program is
+/// valid are raised
 /// @returns the resolved Program. Program.Diagnostics() may contain validation errors.
 Program Resolve(
     ProgramBuilder& builder,
-    const wgsl::AllowedFeatures& allowed_features = wgsl::AllowedFeatures::Everything());
+    const wgsl::AllowedFeatures& allowed_features = wgsl::AllowedFeatures::Everything(),
+    size_t max_uniformity_analysis_threads = 1,
+    bool fast_fail = false);
 
 }  // namespace tint::resolver
 
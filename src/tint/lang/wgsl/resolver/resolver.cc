@@ -127,7 +127,10 @@ constexpr size_t kMaxNestDepthOfCompositeType = 255;
 
 }  // namespace
 
-Resolver::Resolver(ProgramBuilder* builder, const wgsl::AllowedFeatures& allowed_features)
+Resolver::Resolver(ProgramBuilder* builder,
+                   const wgsl::AllowedFeatures& allowed_features,
+                   size_t max_uniformity_analysis_threads,
+                   bool fast_fail)
     : b(*builder),
       diagnostics_(builder->Diagnostics()),
       const_eval_(builder->constants, diagnostics_),
@@ -138,8 +141,13 @@ Resolver::Resolver(ProgramBuilder* builder, const wgsl::AllowedFeatures& allowed
                  enabled_extensions_,
                  allowed_features_,
                  atomic_composite_info_,
-                 valid_type_storage_layouts_),
-      allowed_features_(allowed_features) {}
+                 valid_type_storage_layouts_,
+                 fast_fail),
+      allowed_features_(allowed_features),
+      max_uniformity_analysis_threads_(max_uniformity_analysis_threads),
+      fast_fail_(fast_fail) {
+    intrinsic_table_.context.detailed_errors = !fast_fail;
+}
 
 Resolver::~Resolver() = default;
 
@@ -177,7 +185,7 @@ bool Resolver::Resolve() {
         enabled_extensions_.Contains(wgsl::Extension::kChromiumDisableUniformityAnalysis);
     if (result && !disable_uniformity_analysis) {
         // Run the uniformity analysis, which requires a complete semantic module.
-        if (!AnalyzeUniformity(b, dependencies_)) {
+        if (!AnalyzeUniformity(b, dependencies_, max_uniformity_analysis_threads_, fast_fail_)) {
             return false;
         }
     }
@@ -3104,15 +3112,19 @@ sem::Call* Resolver::FunctionCall(const ast::CallExpression* expr,
         // Note: Requires called functions to be resolved first.
         // This is currently guaranteed as functions must be declared before
         // use.
-        current_function_->AddTransitivelyCalledFunction(target);
         current_function_->AddDirectCall(call);
-        for (auto* transitive_call : target->TransitivelyCalledFunctions()) {
-            current_function_->AddTransitivelyCalledFunction(transitive_call);
-        }
+        if (current_function_->AddTransitivelyCalledFunction(target)) {
+            // The callee's transitively called functions and referenced globals are complete, and
+            // have already been inherited if the callee was previously called directly or
+            // transitively by this function. Only merge them on the first call.
+            for (auto* transitive_call : target->TransitivelyCalledFunctions()) {
+                current_function_->AddTransitivelyCalledFunction(transitive_call);
+            }
 
-        // We inherit any referenced variables from the callee.
-        for (auto* var : target->TransitivelyReferencedGlobals()) {
-            current_function_->AddTransitivelyReferencedGlobal(var);
+            // We inherit any referenced variables from the callee.
+            for (auto* var : target->TransitivelyReferencedGlobals()) {
+                current_function_->AddTransitivelyReferencedGlobal(var);
+            }
         }
 
         if (!AliasAnalysis(call)) {
@@ -99,7 +99,14 @@ class Resolver {
     /// Constructor
     /// @param builder the program builder
     /// @param allowed_features the extensions and features that are allowed to be used
-    explicit Resolver(ProgramBuilder* builder, const wgsl::AllowedFeatures& allowed_features);
+    /// @param max_uniformity_analysis_threads the maximum number of threads used by the uniformity
+    /// analysis
+    /// @param fast_fail if true, then the resolver only raises the diagnostics needed to determine
+    /// whether the program is valid. Warnings and notes are not raised, and errors are terse.
+    explicit Resolver(ProgramBuilder* builder,
+                      const wgsl::AllowedFeatures& allowed_features,
+                      size_t max_uniformity_analysis_threads = 1,
+                      bool fast_fail = false);
 
     /// Destructor
     ~Resolver();
@@ -700,6 +707,8 @@ class Resolver {
     SemHelper sem_;
     Validator validator_;
     wgsl::AllowedFeatures allowed_features_;
+    size_t max_uniformity_analysis_threads_ = 1;
+    bool fast_fail_ = false;
     wgsl::Extensions enabled_extensions_;
     Vector<sem::Function*, 8> entry_points_;
     Hashmap<const core::type::Type*, const Source*, 8> atomic_composite_info_;
@@ -1012,6 +1012,42 @@ TEST_F(ResolverTest, Function_RegisterInputOutputVariables_SubFunction) {
     EXPECT_EQ(vars[2]->Declaration(), priv_var);
 }
 
+TEST_F(ResolverTest, Function_TransitivelyCalled_MultipleCallSites) {
+    auto* a_var = GlobalVar("a_var", ty.f32(), core::AddressSpace::kPrivate);
+    auto* b_var = GlobalVar("b_var", ty.f32(), core::AddressSpace::kPrivate);
+    auto* c_var = GlobalVar("c_var", ty.f32(), core::AddressSpace::kPrivate);
+
+    auto* a = Func("a", tint::Empty, ty.void_(), Vector{Assign("a_var", 1_f)});
+    auto* b = Func("b", tint::Empty, ty.void_(),
+                   Vector{CallStmt(Call("a")), Assign("b_var", 1_f), CallStmt(Call("a"))});
+    auto* c = Func("c", tint::Empty, ty.void_(),
+                   Vector{CallStmt(Call("b")), CallStmt(Call("a")), Assign("c_var", 1_f),
+                          CallStmt(Call("b"))});
+
+    EXPECT_TRUE(r()->Resolve()) << r()->error();
+
+    auto* a_sem = Sem().Get(a);
+    auto* b_sem = Sem().Get(b);
+    auto* c_sem = Sem().Get(c);
+    ASSERT_NE(a_sem, nullptr);
+    ASSERT_NE(b_sem, nullptr);
+    ASSERT_NE(c_sem, nullptr);
+
+    EXPECT_EQ(b_sem->DirectCalls().Length(), 2u);
+    EXPECT_EQ(c_sem->DirectCalls().Length(), 3u);
+
+    const auto& c_calls = c_sem->TransitivelyCalledFunctions();
+    ASSERT_EQ(c_calls.Length(), 2u);
+    EXPECT_EQ(c_calls[0], b_sem);
+    EXPECT_EQ(c_calls[1], a_sem);
+
+    const auto& c_vars = c_sem->TransitivelyReferencedGlobals();
+    ASSERT_EQ(c_vars.Length(), 3u);
+    EXPECT_EQ(c_vars[0]->Declaration(), a_var);
+    EXPECT_EQ(c_vars[1]->Declaration(), b_var);
+    EXPECT_EQ(c_vars[2]->Declaration(), c_var);
+}
+
 TEST_F(ResolverTest, Function_NotRegisterFunctionVariable) {
     auto* func = Func("my_func", tint::Empty, ty.void_(),
                       Vector{
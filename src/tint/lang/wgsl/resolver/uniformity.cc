@@ -27,8 +27,11 @@
 
 #include "src/tint/lang/wgsl/resolver/uniformity.h"
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -253,6 +256,10 @@ struct FunctionInfo {
     /// Special `Value_return` node.
     Node* value_return = nullptr;
 
+    /// The severities of the uniformity violations found in the function. These are reported by
+    /// UniformityGraph::ReportViolations() once the function has been analyzed.
+    Vector<wgsl::DiagnosticSeverity, 2> violations;
+
     /// Map from variables to their value nodes in the graph, scoped with respect to control flow.
     ScopeStack<const sem::Variable*, Node*> variables;
 
@@ -352,8 +359,22 @@ class UniformityGraph {
   public:
     /// Constructor.
     /// @param builder the program to analyze
-    explicit UniformityGraph(ProgramBuilder& builder)
-        : b(builder), sem_(b.Sem()), diagnostics_(builder.Diagnostics()) {}
+    /// @param fast_fail if true, only the uniformity errors are reported, without notes
+    UniformityGraph(ProgramBuilder& builder, bool fast_fail)
+        : b(builder),
+          sem_(b.Sem()),
+          diagnostics_(builder.Diagnostics()),
+          fast_fail_(fast_fail),
+          functions_(own_functions_) {}
+
+    /// Constructor for a graph that analyzes functions on a worker thread.
+    /// @param parent the graph that holds the analyzed function results
+    explicit UniformityGraph(UniformityGraph* parent)
+        : b(parent->b),
+          sem_(parent->sem_),
+          diagnostics_(parent->diagnostics_),
+          fast_fail_(parent->fast_fail_),
+          functions_(parent->functions_) {}
 
     /// Destructor.
     ~UniformityGraph() {}
@@ -361,18 +382,32 @@ class UniformityGraph {
     /// Build and analyze the graph to determine whether the program satisfies the uniformity
     /// constraints of WGSL.
     /// @param dependency_graph the dependency-ordered module-scope declarations
+    /// @param max_threads the maximum number of threads used to analyze functions
     /// @returns true if all uniformity constraints are satisfied, otherise false
-    bool Build(const DependencyGraph& dependency_graph) {
+    bool Build(const DependencyGraph& dependency_graph, size_t max_threads) {
 #if TINT_DUMP_UNIFORMITY_GRAPH
         std::cout << "digraph G {\n";
         std::cout << "rankdir=BT\n";
+        max_threads = 1;  // Keep the graph dump in order.
 #endif
 
-        // Process all functions in the module.
-        bool success = true;
+        Vector<const ast::Function*, 64> funcs;
         for (auto* decl : dependency_graph.ordered_globals) {
             if (auto* func = decl->As<ast::Function>()) {
-                if (!ProcessFunction(func)) {
+                funcs.Push(func);
+            }
+        }
+
+        bool success = true;
+        if (max_threads > 1 && funcs.Length() > 1) {
+            success = ProcessFunctionsConcurrently(funcs, max_threads);
+        } else {
+            // Process all functions in the module.
+            for (auto* func : funcs) {
+                auto& info = functions_.Add(func, FunctionInfo(func, b)).value;
+                bool ok = ProcessFunction(func, info);
+                ReportViolations(info);
+                if (!ok) {
                     success = false;
                     break;
                 }
@@ -390,9 +425,13 @@ class UniformityGraph {
     const ProgramBuilder& b;
     const sem::Info& sem_;
     diag::List& diagnostics_;
+    const bool fast_fail_;
+
+    /// Storage for functions_, used by the graph that is not analyzing on a worker thread.
+    Hashmap<const ast::Function*, FunctionInfo, 8> own_functions_;
 
     /// Map of analyzed function results.
-    Hashmap<const ast::Function*, FunctionInfo, 8> functions_;
+    Hashmap<const ast::Function*, FunctionInfo, 8>& functions_;
 
     /// The function currently being analyzed.
     FunctionInfo* current_function_;
@@ -427,11 +466,101 @@ class UniformityGraph {
         return fn->Declaration()->name->symbol.Name();
     }
 
+    /// Processes the functions @p funcs, which are in dependency order, using up to @p max_threads
+    /// threads.
+    /// Each function is assigned to a wave that is one greater than the largest wave of the
+    /// functions it calls. Functions in the same wave do not depend on each other, so each wave is
+    /// processed concurrently once the previous waves have completed.
+    /// The violations are reported in dependency order once all the waves have been processed, so
+    /// the diagnostics are identical to those produced by processing the functions serially.
+    /// @param funcs the functions in dependency order
+    /// @param max_threads the maximum number of threads to use
+    /// @returns true if there are no uniformity errors, false otherwise
+    bool ProcessFunctionsConcurrently(VectorRef<const ast::Function*> funcs, size_t max_threads) {
+        Hashmap<const ast::Function*, size_t, 64> func_waves;
+        Vector<Vector<size_t, 8>, 16> waves;
+        for (size_t i = 0; i < funcs.Length(); i++) {
+            size_t wave = 0;
+            for (auto* call : sem_.Get(funcs[i])->DirectCalls()) {
+                if (auto* callee = call->Target()->As<sem::Function>()) {
+                    wave = std::max(wave, *func_waves.Get(callee->Declaration()) + 1);
+                }
+            }
+            func_waves.Add(funcs[i], wave);
+            if (wave >= waves.Length()) {
+                waves.Resize(wave + 1);
+            }
+            waves[wave].Push(i);
+        }
+
+        // The serial analysis stops at the first function with a uniformity error. Functions
+        // after this one in dependency order are skipped. The callers of a function always follow
+        // it in dependency order, so the remaining functions can still be processed.
+        size_t first_error = funcs.Length();
+
+        for (auto& wave : waves) {
+            // Add the wave's functions to functions_ before starting the threads, so that the map
+            // is only read while the functions are being processed.
+            Vector<size_t, 8> indices;
+            Vector<FunctionInfo*, 8> infos;
+            for (auto i : wave) {
+                if (i < first_error) {
+                    indices.Push(i);
+                    infos.Push(&functions_.Add(funcs[i], FunctionInfo(funcs[i], b)).value);
+                }
+            }
+
+            std::vector<char> ok(indices.Length(), 0);
+            std::atomic<size_t> next{0};
+            auto process = [&](UniformityGraph& graph) {
+                for (size_t n = next++; n < indices.Length(); n = next++) {
+                    ok[n] = graph.ProcessFunction(funcs[indices[n]], *infos[n]);
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (size_t t = 1; t < std::min(max_threads, indices.Length()); t++) {
+                threads.emplace_back([&] {
+                    UniformityGraph worker(this);
+                    process(worker);
+                });
+            }
+            process(*this);
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            for (size_t n = 0; n < indices.Length(); n++) {
+                if (!ok[n]) {
+                    first_error = std::min(first_error, indices[n]);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < funcs.Length() && i <= first_error; i++) {
+            ReportViolations(*functions_.Get(funcs[i]));
+        }
+        return first_error == funcs.Length();
+    }
+
+    /// Reports the uniformity violations found by ProcessFunction() for the function @p function.
+    /// @param function the function
+    void ReportViolations(FunctionInfo& function) {
+        for (auto severity : function.violations) {
+            if (fast_fail_ && severity != wgsl::DiagnosticSeverity::kError) {
+                continue;  // Warnings do not affect the validity of the program.
+            }
+            MakeError(function, function.may_be_non_uniform, severity);
+        }
+    }
+
     /// Process a function.
+    /// Uniformity violations are recorded in FunctionInfo::violations, and are not reported.
     /// @param func the function to process
-    /// @returns true if there are no uniformity issues, false otherwise
-    bool ProcessFunction(const ast::Function* func) {
-        current_function_ = &functions_.Add(func, FunctionInfo(func, b)).value;
+    /// @param info the function's FunctionInfo
+    /// @returns true if there are no uniformity errors, false otherwise
+    bool ProcessFunction(const ast::Function* func, FunctionInfo& info) {
+        current_function_ = &info;
 
         // Process function body.
         if (func->body) {
@@ -476,7 +605,7 @@ class UniformityGraph {
             auto traverse = [&](wgsl::DiagnosticSeverity severity) {
                 Traverse(current_function_->RequiredToBeUniform(severity), &reachable);
                 if (reachable.Contains(current_function_->may_be_non_uniform)) {
-                    MakeError(*current_function_, current_function_->may_be_non_uniform, severity);
+                    current_function_->violations.Push(severity);
                     return false;
                 }
                 if (reachable.Contains(current_function_->cf_start)) {
@@ -1980,6 +2109,10 @@ class UniformityGraph {
                           is_value ? param_info.value : param_info.ptr_input_contents, severity);
             }
 
+            if (fast_fail_ && user_func) {
+                return;
+            }
+
             // Show the place where the non-uniform argument was passed.
             // If this is a builtin, this will be the trigger location for the failure.
             StringStream ss;
@@ -1987,6 +2120,10 @@ class UniformityGraph {
                << " here";
             report(call->args[cause->arg_index]->source, ss.str(), /* note */ user_func != nullptr);
 
+            if (fast_fail_) {
+                return;
+            }
+
             // Show the origin of non-uniformity for the value or data that is being passed.
             ShowSourceOfNonUniformity(source_node->visited_from);
         } else {
@@ -2000,6 +2137,10 @@ class UniformityGraph {
                 report(builtin_call->source, ss.str(), /* note */ false);
             }
 
+            if (fast_fail_) {
+                return;
+            }
+
             if (builtin_call != call) {
                 // The call was to a user function, so show that call too.
                 StringStream ss;
@@ -2024,9 +2165,12 @@ class UniformityGraph {
 
 }  // namespace
 
-bool AnalyzeUniformity(ProgramBuilder& builder, const DependencyGraph& dependency_graph) {
-    UniformityGraph graph(builder);
-    return graph.Build(dependency_graph);
+bool AnalyzeUniformity(ProgramBuilder& builder,
+                       const DependencyGraph& dependency_graph,
+                       size_t max_threads,
+                       bool fast_fail) {
+    UniformityGraph graph(builder, fast_fail);
+    return graph.Build(dependency_graph, max_threads);
 }
 
 }  // namespace tint::resolver
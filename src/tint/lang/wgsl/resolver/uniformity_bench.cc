@@ -0,0 +1,114 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+#include <thread>
+
+#include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/wgsl/program/program_builder.h"
+#include "src/tint/lang/wgsl/resolver/dependency_graph.h"
+#include "src/tint/lang/wgsl/resolver/resolve.h"
+#include "src/tint/lang/wgsl/resolver/uniformity.h"
+
+namespace tint::resolver {
+namespace {
+
+using namespace tint::core::number_suffixes;  // NOLINT
+
+/// Runs the uniformity analysis on @p program using @p max_threads threads.
+void RunUniformityAnalysis(benchmark::State& state, const Program& program, size_t max_threads) {
+    auto builder = ProgramBuilder::Wrap(program);
+    DependencyGraph dependency_graph;
+    if (!DependencyGraph::Build(builder.AST(), builder.Diagnostics(), dependency_graph)) {
+        state.SkipWithError(builder.Diagnostics().Str());
+        return;
+    }
+    for (auto _ : state) {
+        if (!AnalyzeUniformity(builder, dependency_graph, max_threads)) {
+            state.SkipWithError(builder.Diagnostics().Str());
+        }
+    }
+}
+
+void UniformityAnalysis(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    RunUniformityAnalysis(state, res->program, 1);
+}
+
+TINT_BENCHMARK_PROGRAMS(UniformityAnalysis);
+
+void UniformityAnalysisConcurrent(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    RunUniformityAnalysis(state, res->program, std::thread::hardware_concurrency());
+}
+
+TINT_BENCHMARK_PROGRAMS(UniformityAnalysisConcurrent);
+
+/// Builds a program with many helper functions that do not call each other, and an entry point
+/// that calls all of them.
+Program BuildProgramWithManyHelpers() {
+    ProgramBuilder b;
+    Vector<const ast::Statement*, 256> main_body;
+    for (int32_t i = 0; i < 256; i++) {
+        auto name = "helper_" + std::to_string(i);
+        b.Func(name, Vector{b.Param("v", b.ty.i32())}, b.ty.i32(),
+               Vector{
+                   b.Decl(b.Var("x", b.Expr("v"))),
+                   b.For(b.Decl(b.Var("j", b.Expr(0_i))), b.LessThan("j", "v"), b.Increment("j"),
+                         b.Block(b.Assign("x", b.Add("x", "j")))),
+                   b.If(b.Equal("x", b.Expr(core::i32(i))),
+                        b.Block(b.CallStmt(b.Call("workgroupBarrier")))),
+                   b.Return("x"),
+               });
+        main_body.Push(b.Assign(b.Phony(), b.Call(name, 0_i)));
+    }
+    b.Func("main", tint::Empty, b.ty.void_(), std::move(main_body),
+           Vector{b.Stage(ast::PipelineStage::kCompute), b.WorkgroupSize(1_i)});
+    return Resolve(b);
+}
+
+void UniformityAnalysisManyHelpers(benchmark::State& state) {
+    auto program = BuildProgramWithManyHelpers();
+    if (!program.IsValid()) {
+        state.SkipWithError(program.Diagnostics().Str());
+        return;
+    }
+    RunUniformityAnalysis(state, program, static_cast<size_t>(state.range(0)));
+}
+
+BENCHMARK(UniformityAnalysisManyHelpers)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+
+}  // namespace
+}  // namespace tint::resolver
@@ -76,6 +76,12 @@ class UniformityAnalysisTestBase {
         options.allowed_features = wgsl::AllowedFeatures::Everything();
         auto file = std::make_unique<Source::File>("test", src);
         auto program = wgsl::reader::Parse(file.get(), options);
+
+        // The diagnostics must not depend on the number of threads used by the analysis.
+        options.max_uniformity_analysis_threads = 4;
+        auto concurrent = wgsl::reader::Parse(file.get(), options);
+        EXPECT_EQ(concurrent.Diagnostics().Str(), program.Diagnostics().Str());
+
         return RunTest(std::move(program), should_pass);
     }
 
@@ -10096,5 +10102,133 @@ test:11:7 note: reading from read_write storage buffer 'non_uniform' may result
 )");
 }
 
+TEST_F(UniformityAnalysisTest, Concurrent_DiagnosticsInDependencyOrder) {
+    // Test that the diagnostics of functions that are analyzed concurrently are reported in
+    // dependency order, and that functions after the first error are not reported.
+    std::string src = R"(
+@group(0) @binding(0) var<storage, read_write> non_uniform : i32;
+
+@diagnostic(warning, derivative_uniformity)
+fn a() {
+  if (non_uniform == 0) {
+    _ = dpdx(1.0);
+  }
+}
+
+fn b() {
+  if (non_uniform == 1) {
+    workgroupBarrier();
+  }
+}
+
+fn c() {
+  if (non_uniform == 2) {
+    workgroupBarrier();
+  }
+}
+
+@diagnostic(warning, derivative_uniformity)
+fn d() {
+  if (non_uniform == 3) {
+    _ = dpdx(1.0);
+  }
+}
+)";
+
+    RunTest(src, false);
+    EXPECT_EQ(error_,
+              R"(test:7:9 warning: 'dpdx' must only be called from uniform control flow
+    _ = dpdx(1.0);
+        ^^^^^^^^^
+
+test:6:3 note: control flow depends on possibly non-uniform value
+  if (non_uniform == 0) {
+  ^^
+
+test:6:7 note: reading from read_write storage buffer 'non_uniform' may result in a non-uniform value
+  if (non_uniform == 0) {
+      ^^^^^^^^^^^
+
+test:13:5 error: 'workgroupBarrier' must only be called from uniform control flow
+    workgroupBarrier();
+    ^^^^^^^^^^^^^^^^
+
+test:12:3 note: control flow depends on possibly non-uniform value
+  if (non_uniform == 1) {
+  ^^
+
+test:12:7 note: reading from read_write storage buffer 'non_uniform' may result in a non-uniform value
+  if (non_uniform == 1) {
+      ^^^^^^^^^^^
+)");
+}
+
+TEST_F(UniformityAnalysisTest, FastFail_OnlyErrorsReported) {
+    // Test that when failing fast, the warnings and the notes that explain an error are omitted.
+    std::string src = R"(
+@group(0) @binding(0) var<storage, read_write> non_uniform : i32;
+
+@diagnostic(warning, derivative_uniformity)
+fn a() {
+  if (non_uniform == 0) {
+    _ = dpdx(1.0);
+  }
+}
+
+fn b(v : i32) {
+  if (v == 1) {
+    workgroupBarrier();
+  }
+}
+
+fn c() {
+  b(non_uniform);
+}
+)";
+
+    wgsl::reader::Options options;
+    options.fast_fail = true;
+    auto file = std::make_unique<Source::File>("test", src);
+    auto program = wgsl::reader::Parse(file.get(), options);
+    EXPECT_FALSE(program.IsValid());
+    EXPECT_EQ(program.Diagnostics().Str(),
+              R"(test:13:5 error: 'workgroupBarrier' must only be called from uniform control flow
+    workgroupBarrier();
+    ^^^^^^^^^^^^^^^^
+)");
+}
+
+TEST_F(UniformityAnalysisTest, Concurrent_ManyFunctions) {
+    // Build a module with several waves of functions that can be analyzed concurrently, with a
+    // uniformity requirement that is propagated through parameters from the leaf functions.
+    StringStream ss;
+    ss << "@group(0) @binding(0) var<storage, read_write> non_uniform : i32;\n";
+    for (int i = 0; i < 32; i++) {
+        ss << "fn leaf_" << i << "(v : i32) -> i32 {\n";
+        ss << "  if (v == " << i << ") {\n";
+        ss << "    workgroupBarrier();\n";
+        ss << "  }\n";
+        ss << "  return v;\n";
+        ss << "}\n";
+    }
+    for (int i = 0; i < 8; i++) {
+        ss << "fn node_" << i << "(v : i32) -> i32 {\n";
+        ss << "  var x = v;\n";
+        for (int j = 0; j < 4; j++) {
+            ss << "  x += leaf_" << (i * 4 + j) << "(v);\n";
+        }
+        ss << "  return x;\n";
+        ss << "}\n";
+    }
+    ss << "fn main() {\n";
+    for (int i = 0; i < 8; i++) {
+        ss << "  _ = node_" << i << "(" << (i == 5 ? "non_uniform" : "0") << ");\n";
+    }
+    ss << "}\n";
+
+    RunTest(ss.str(), false);
+    EXPECT_THAT(error_, ::testing::HasSubstr("note: possibly non-uniform value passed here"));
+}
+
 }  // namespace
 }  // namespace tint::resolver
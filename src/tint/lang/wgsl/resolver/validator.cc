@@ -162,14 +162,16 @@ Validator::Validator(
     const wgsl::Extensions& enabled_extensions,
     const wgsl::AllowedFeatures& allowed_features,
     const Hashmap<const core::type::Type*, const Source*, 8>& atomic_composite_info,
-    Hashset<TypeAndAddressSpace, 8>& valid_type_storage_layouts)
+    Hashset<TypeAndAddressSpace, 8>& valid_type_storage_layouts,
+    bool fast_fail)
     : symbols_(builder->Symbols()),
       diagnostics_(builder->Diagnostics()),
       sem_(sem),
       enabled_extensions_(enabled_extensions),
       allowed_features_(allowed_features),
       atomic_composite_info_(atomic_composite_info),
-      valid_type_storage_layouts_(valid_type_storage_layouts) {
+      valid_type_storage_layouts_(valid_type_storage_layouts),
+      fast_fail_(fast_fail) {
     // Set default severities for filterable diagnostic rules.
     diagnostic_filters_.Set(wgsl::CoreDiagnosticRule::kDerivativeUniformity,
                             wgsl::DiagnosticSeverity::kError);
@@ -194,6 +196,9 @@ diag::Diagnostic& Validator::AddNote(const Source& source) const {
 diag::Diagnostic* Validator::MaybeAddDiagnostic(wgsl::DiagnosticRule rule,
                                                 const Source& source) const {
     auto severity = diagnostic_filters_.Get(rule);
+    if (fast_fail_ && severity != wgsl::DiagnosticSeverity::kError) {
+        return nullptr;
+    }
     if (severity != wgsl::DiagnosticSeverity::kOff) {
         diag::Diagnostic d{};
         d.severity = ToSeverity(severity);
@@ -118,12 +118,14 @@ class Validator {
     /// @param allowed_features the allowed extensions and features
     /// @param atomic_composite_info atomic composite info of the module
     /// @param valid_type_storage_layouts a set of validated type layouts by address space
+    /// @param fast_fail if true, filterable diagnostics below error severity are not raised
     Validator(ProgramBuilder* builder,
               SemHelper& helper,
               const wgsl::Extensions& enabled_extensions,
               const wgsl::AllowedFeatures& allowed_features,
               const Hashmap<const core::type::Type*, const Source*, 8>& atomic_composite_info,
-              Hashset<TypeAndAddressSpace, 8>& valid_type_storage_layouts);
+              Hashset<TypeAndAddressSpace, 8>& valid_type_storage_layouts,
+              bool fast_fail = false);
     ~Validator();
 
     /// @returns an error diagnostic
@@ -611,6 +613,7 @@ class Validator {
     const wgsl::AllowedFeatures& allowed_features_;
     const Hashmap<const core::type::Type*, const Source*, 8>& atomic_composite_info_;
     Hashset<TypeAndAddressSpace, 8>& valid_type_storage_layouts_;
+    const bool fast_fail_;
 };
 
 }  // namespace tint::resolver
@@ -123,8 +123,9 @@ class Function final : public Castable<Function, CallTarget> {
 
     /// Records that this function transitively calls `function`.
     /// @param function the function this function transitively calls
-    void AddTransitivelyCalledFunction(const Function* function) {
-        transitively_called_functions_.Add(function);
+    /// @returns true if `function` was not already recorded as transitively called
+    bool AddTransitivelyCalledFunction(const Function* function) {
+        return transitively_called_functions_.Add(function);
     }
 
     /// @returns the list of builtins that this function directly calls.
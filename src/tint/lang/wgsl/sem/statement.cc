@@ -54,7 +54,15 @@ const BlockStatement* Statement::Block() const {
 
 void Statement::SetDiagnosticSeverity(wgsl::DiagnosticRule rule,
                                       wgsl::DiagnosticSeverity severity) {
-    diagnostic_severities_.Add(rule, severity);
+    if (!diagnostic_severities_) {
+        diagnostic_severities_ = std::make_unique<wgsl::DiagnosticRuleSeverities>();
+    }
+    diagnostic_severities_->Add(rule, severity);
+}
+
+const wgsl::DiagnosticRuleSeverities& Statement::DiagnosticSeverities() const {
+    static const wgsl::DiagnosticRuleSeverities kNone;
+    return diagnostic_severities_ ? *diagnostic_severities_ : kNone;
 }
 
 CompoundStatement::CompoundStatement(const ast::Statement* declaration,
@@ -28,6 +28,8 @@
 #ifndef SRC_TINT_LANG_WGSL_SEM_STATEMENT_H_
 #define SRC_TINT_LANG_WGSL_SEM_STATEMENT_H_
 
+#include <memory>
+
 #include "src/tint/lang/wgsl/ast/diagnostic_control.h"
 #include "src/tint/lang/wgsl/sem/behavior.h"
 #include "src/tint/lang/wgsl/sem/node.h"
@@ -129,9 +131,7 @@ class Statement : public Castable<Statement, Node> {
     void SetDiagnosticSeverity(wgsl::DiagnosticRule rule, wgsl::DiagnosticSeverity severity);
 
     /// @returns the diagnostic severity modifications applied to this statement
-    const wgsl::DiagnosticRuleSeverities& DiagnosticSeverities() const {
-        return diagnostic_severities_;
-    }
+    const wgsl::DiagnosticRuleSeverities& DiagnosticSeverities() const;
 
   private:
     const ast::Statement* const declaration_;
@@ -139,7 +139,9 @@ class Statement : public Castable<Statement, Node> {
     const sem::Function* const function_;
     sem::Behaviors behaviors_{sem::Behavior::kNext};
     bool is_reachable_ = true;
-    wgsl::DiagnosticRuleSeverities diagnostic_severities_;
+    /// Allocated by the first call to SetDiagnosticSeverity(). Very few statements have diagnostic
+    /// attributes, so the map is not embedded in every statement.
+    std::unique_ptr<wgsl::DiagnosticRuleSeverities> diagnostic_severities_;
 };
 
 /// CompoundStatement is the base class of statements that can hold other
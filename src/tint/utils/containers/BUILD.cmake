@@ -44,6 +44,8 @@ tint_add_target(tint_utils_containers lib
   utils/containers/containers.cc
   utils/containers/enum_set.h
   utils/containers/filtered_iterator.h
+  utils/containers/grouped_hashmap.h
+  utils/containers/grouped_hashmap_base.h
   utils/containers/hashmap.h
   utils/containers/hashmap_base.h
   utils/containers/hashset.h
@@ -75,6 +77,7 @@ tint_add_target(tint_utils_containers_test test
   utils/containers/bitset_test.cc
   utils/containers/enum_set_test.cc
   utils/containers/filtered_iterator_test.cc
+  utils/containers/grouped_hashmap_test.cc
   utils/containers/hashmap_test.cc
   utils/containers/hashset_test.cc
   utils/containers/map_test.cc
@@ -116,3 +119,25 @@ tint_target_add_dependencies(tint_utils_containers_test test
 tint_target_add_external_dependencies(tint_utils_containers_test test
   "gtest"
 )
+
+################################################################################
+# Target:    tint_utils_containers_bench
+# Kind:      bench
+################################################################################
+tint_add_target(tint_utils_containers_bench bench
+  utils/containers/hashmap_bench.cc
+)
+
+tint_target_add_dependencies(tint_utils_containers_bench bench
+  tint_utils_containers
+  tint_utils_ice
+  tint_utils_macros
+  tint_utils_math
+  tint_utils_memory
+  tint_utils_rtti
+  tint_utils_traits
+)
+
+tint_target_add_external_dependencies(tint_utils_containers_bench bench
+  "google-benchmark"
+)
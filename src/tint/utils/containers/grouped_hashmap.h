@@ -0,0 +1,50 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_UTILS_CONTAINERS_GROUPED_HASHMAP_H_
+#define SRC_TINT_UTILS_CONTAINERS_GROUPED_HASHMAP_H_
+
+#include "src/tint/utils/containers/grouped_hashmap_base.h"
+#include "src/tint/utils/containers/hashmap.h"
+
+namespace tint {
+
+/// GroupedHashmap is a Hashmap that uses GroupedHashmapBase as its hash table.
+///
+/// Compared to the default Hashmap, lookups in maps of many thousands of entries and iteration are
+/// faster, but inserts and lookups in small maps are slower. Use GroupedHashmap only for large,
+/// long-lived, lookup-heavy maps, and benchmark the change with hashmap_bench.cc.
+template <typename KEY,
+          typename VALUE,
+          size_t N,
+          typename HASH = Hasher<KEY>,
+          typename EQUAL = EqualTo<KEY>>
+using GroupedHashmap = Hashmap<KEY, VALUE, N, HASH, EQUAL, GroupedHashmapBase>;
+
+}  // namespace tint
+
+#endif  // SRC_TINT_UTILS_CONTAINERS_GROUPED_HASHMAP_H_
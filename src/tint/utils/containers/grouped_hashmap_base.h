@@ -0,0 +1,798 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_UTILS_CONTAINERS_GROUPED_HASHMAP_BASE_H_
+#define SRC_TINT_UTILS_CONTAINERS_GROUPED_HASHMAP_BASE_H_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "src/tint/utils/containers/hashmap_base.h"
+#include "src/tint/utils/containers/vector.h"
+#include "src/tint/utils/ice/ice.h"
+#include "src/tint/utils/math/hash.h"
+#include "src/tint/utils/math/math.h"
+#include "src/tint/utils/memory/aligned_storage.h"
+#include "src/tint/utils/traits/traits.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TINT_GROUPED_HASHMAP_USE_SSE2 1
+#else
+#define TINT_GROUPED_HASHMAP_USE_SSE2 0
+#endif
+
+namespace tint {
+
+/// GroupedHashmapBase is an alternative base class for Hashmap, used by GroupedHashmap.
+///
+/// GroupedHashmapBase is an open-addressing hash table that indexes the map's entries with groups
+/// of one-byte control values, in the style of a 'Swiss table'. Each control byte holds either
+/// kEmpty, kDeleted, or the low 7 bits of the entry's mixed hash. A lookup probes whole groups of
+/// kGroupSize buckets at a time, comparing all the group's control bytes against the hash in a
+/// single SIMD operation where supported, and only compares keys for the matching buckets.
+///
+/// The entries themselves are held in nodes which are never moved by the map, so pointers to
+/// entries remain valid until the entry is removed, the map is cleared, or the map is destructed.
+/// The first kMinCapacity nodes, and the groups needed to index them, are held inline in the map.
+///
+/// @tparam ENTRY is the single record in the map. The entry type must alias 'Key' to the HashmapKey
+/// type, and implement the method `static HashmapKey<...> KeyOf(ENTRY)` to return the key for the
+/// entry.
+template <typename ENTRY, size_t N>
+class GroupedHashmapBase {
+  protected:
+    struct Node;
+    struct Group;
+
+  public:
+    /// Entry is the type of a single record in the hashmap.
+    using Entry = ENTRY;
+    /// Key is the HashmapKey type used to find entries.
+    using Key = typename Entry::Key;
+    /// Hash is the
+    using Hash = typename Key::Hash;
+    /// Equal is the
+    using Equal = typename Key::Equal;
+
+    /// The minimum capacity of the map.
+    static constexpr size_t kMinCapacity = std::max<size_t>(N, 8);
+
+    /// The number of buckets in a group.
+    static constexpr size_t kGroupSize = 16;
+
+    /// @param num_groups the number of groups
+    /// @returns the maximum number of live and deleted buckets in @p num_groups groups.
+    /// At least one in eight buckets is kept empty to keep probe sequences short.
+    static constexpr size_t MaxLoad(size_t num_groups) {
+        return num_groups * kGroupSize - (num_groups * kGroupSize) / 8;
+    }
+
+    /// @param capacity the capacity of the map, as total number of entries.
+    /// @returns the number of groups required to index @p capacity map entries. Always a power of
+    /// two.
+    static constexpr size_t NumGroups(size_t capacity) {
+        size_t num_groups = 1;
+        while (MaxLoad(num_groups) < std::max<size_t>(capacity, kMinCapacity)) {
+            num_groups *= 2;
+        }
+        return num_groups;
+    }
+
+    /// Constructor.
+    /// Constructs an empty map.
+    GroupedHashmapBase() {
+        for (auto& node : fixed_) {
+            free_.Add(&node);
+        }
+    }
+
+    /// Copy constructor.
+    /// Constructs a map with a copy of @p other.
+    /// @param other the map to copy.
+    GroupedHashmapBase(const GroupedHashmapBase& other) : GroupedHashmapBase() {
+        if (&other != this) {
+            Copy(other);
+        }
+    }
+
+    /// Move constructor.
+    /// Constructs a map with the moved entries of @p other.
+    /// @param other the map to move.
+    GroupedHashmapBase(GroupedHashmapBase&& other) : GroupedHashmapBase() {
+        if (&other != this) {
+            Move(std::move(other));
+        }
+    }
+
+    /// Destructor.
+    ~GroupedHashmapBase() {
+        // Call the destructor on all entries in the map.
+        for (auto& group : Groups()) {
+            for (size_t i = 0; i < kGroupSize; i++) {
+                if (IsFull(group.ctrl[i])) {
+                    group.nodes[i]->Destroy();
+                }
+            }
+        }
+    }
+
+    /// Assignment operator.
+    /// Clears this map, and populates this map with a copy of @p other.
+    /// @param other the map to copy.
+    /// @returns this GroupedHashmapBase
+    GroupedHashmapBase& operator=(const GroupedHashmapBase& other) {
+        if (&other != this) {
+            Clear();
+            Copy(other);
+        }
+        return *this;
+    }
+
+    /// Move-assignment operator.
+    /// Clears this map, and populates this map with the moved entries of @p other.
+    /// @param other the map to move.
+    /// @returns this GroupedHashmapBase
+    GroupedHashmapBase& operator=(GroupedHashmapBase&& other) {
+        if (&other != this) {
+            Clear();
+            Move(std::move(other));
+        }
+        return *this;
+    }
+
+    /// @returns the number of entries in the map.
+    size_t Count() const { return count_; }
+
+    /// @returns true if the map holds no entries.
+    bool IsEmpty() const { return count_ == 0; }
+
+    /// Removes all the entries from the map.
+    /// @note the map's capacity is not reduced, as it is assumed that a reused map will likely fill
+    /// to a similar size as before.
+    void Clear() {
+        for (auto& group : Groups()) {
+            for (size_t i = 0; i < kGroupSize; i++) {
+                if (IsFull(group.ctrl[i])) {
+                    group.nodes[i]->Destroy();
+                    free_.Add(group.nodes[i]);
+                }
+            }
+            group.ctrl.fill(kEmpty);
+        }
+        count_ = 0;
+        num_deleted_ = 0;
+    }
+
+    /// Ensures that the map can hold @p n entries without heap reallocation or rehashing.
+    /// @param n the number of entries to ensure can fit in the map without reallocation or
+    /// rehashing.
+    void Reserve(size_t n) {
+        if (n > capacity_) {
+            size_t count = n - capacity_;
+            free_.Allocate(count);
+            capacity_ += count;
+            Grow();
+        }
+    }
+
+    /// Looks up an entry with the given key.
+    /// @param key the entry's key to search for.
+    /// @returns a pointer to the matching entry, or null if no entry was found.
+    /// @note The returned pointer is guaranteed to be valid until the owning entry is removed,
+    /// the map is cleared, or the map is destructed.
+    template <typename K>
+    Entry* GetEntry(K&& key) {
+        size_t bucket = Find(Hash{}(key), key);
+        return bucket != kNotFound ? &NodeAt(bucket)->Entry() : nullptr;
+    }
+
+    /// Looks up an entry with the given key.
+    /// @param key the entry's key to search for.
+    /// @returns a pointer to the matching entry, or null if no entry was found.
+    /// @note The returned pointer is guaranteed to be valid until the owning entry is removed,
+    /// the map is cleared, or the map is destructed.
+    template <typename K>
+    const Entry* GetEntry(K&& key) const {
+        size_t bucket = Find(Hash{}(key), key);
+        return bucket != kNotFound ? &NodeAt(bucket)->Entry() : nullptr;
+    }
+
+    /// @returns true if the map contains an entry with a key that matches @p key.
+    /// @param key the key to look for.
+    template <typename K = Key>
+    bool Contains(K&& key) const {
+        return GetEntry(key) != nullptr;
+    }
+
+    /// Removes an entry from the map that has a key which matches @p key.
+    /// @returns true if the entry was found and removed, otherwise false.
+    /// @param key the key to look for.
+    template <typename K = Key>
+    bool Remove(K&& key) {
+        size_t bucket = Find(Hash{}(key), key);
+        if (bucket == kNotFound) {
+            return false;
+        }
+        auto& group = groups_[bucket / kGroupSize];
+        auto* node = group.nodes[bucket % kGroupSize];
+        node->Destroy();
+        free_.Add(node);
+        count_--;
+        // If the group has an empty bucket, then the group has never been full since the last
+        // rehash, and so no probe sequence has passed over this group. The bucket can be reused
+        // as empty. Otherwise the bucket has to be marked as deleted to preserve probe sequences.
+        if (group.MatchEmpty()) {
+            group.ctrl[bucket % kGroupSize] = kEmpty;
+        } else {
+            group.ctrl[bucket % kGroupSize] = kDeleted;
+            num_deleted_++;
+        }
+        return true;
+    }
+
+    /// Iterator for entries in the map.
+    template <bool IS_CONST>
+    class IteratorT {
+      private:
+        using GROUP = std::conditional_t<IS_CONST, const Group, Group>;
+
+      public:
+        /// @returns the entry pointed to by this iterator
+        auto& operator->() { return Get(); }
+
+        /// @returns a reference to the entry at the iterator
+        auto& operator*() { return Get(); }
+
+        /// Increments the iterator
+        /// @returns this iterator
+        IteratorT& operator++() {
+            full_ &= full_ - 1;
+            SkipEmptyGroups();
+            return *this;
+        }
+
+        /// Equality operator
+        /// @param other the other iterator to compare this iterator to
+        /// @returns true if this iterator is equal to other
+        bool operator==(const IteratorT& other) const {
+            return group_ == other.group_ && full_ == other.full_;
+        }
+
+        /// Inequality operator
+        /// @param other the other iterator to compare this iterator to
+        /// @returns true if this iterator is not equal to other
+        bool operator!=(const IteratorT& other) const { return !(*this == other); }
+
+      private:
+        /// Friend class
+        friend class GroupedHashmapBase;
+
+        IteratorT(GROUP* group, GROUP* end) : group_(group), end_(end) {
+            if (group_ != end_) {
+                full_ = group_->MatchFull();
+                SkipEmptyGroups();
+            }
+        }
+
+        auto& Get() {
+            auto* node = group_->nodes[CountTrailingZeros(full_)];
+            if constexpr (IS_CONST) {
+                return std::as_const(node->Entry());
+            } else {
+                return node->Entry();
+            }
+        }
+
+        void SkipEmptyGroups() {
+            while (full_ == 0 && ++group_ != end_) {
+                full_ = group_->MatchFull();
+            }
+        }
+
+        /// The group holding the current entry
+        GROUP* group_ = nullptr;
+        /// One past the last group of the map
+        GROUP* end_ = nullptr;
+        /// The bitmask of the full buckets of #group_ that have not been visited yet. The current
+        /// entry is in the bucket of the lowest set bit.
+        uint32_t full_ = 0;
+    };
+
+    /// An immutable key and mutable value iterator
+    using Iterator = IteratorT</*IS_CONST*/ false>;
+
+    /// An immutable key and value iterator
+    using ConstIterator = IteratorT</*IS_CONST*/ true>;
+
+    /// @returns an immutable iterator to the start of the map.
+    ConstIterator begin() const { return ConstIterator{groups_, groups_ + num_groups_}; }
+
+    /// @returns an immutable iterator to the end of the map.
+    ConstIterator end() const {
+        return ConstIterator{groups_ + num_groups_, groups_ + num_groups_};
+    }
+
+    /// @returns an iterator to the start of the map.
+    Iterator begin() { return Iterator{groups_, groups_ + num_groups_}; }
+
+    /// @returns an iterator to the end of the map.
+    Iterator end() { return Iterator{groups_ + num_groups_, groups_ + num_groups_}; }
+
+    /// STL-friendly alias to Entry. Used by gmock.
+    using value_type = const Entry&;
+
+  protected:
+    /// Control byte value of a bucket that has never held an entry.
+    static constexpr uint8_t kEmpty = 0x80;
+    /// Control byte value of a bucket that held an entry which has been removed.
+    static constexpr uint8_t kDeleted = 0xfe;
+    /// A bitmask with a bit set for each bucket of a group.
+    static constexpr uint32_t kAllBuckets = (1u << kGroupSize) - 1;
+    /// The value returned by Find() when no entry was found.
+    static constexpr size_t kNotFound = ~static_cast<size_t>(0);
+
+    /// @returns true if the control byte @p ctrl is for a bucket holding an entry.
+    /// @param ctrl the control byte
+    static bool IsFull(uint8_t ctrl) { return (ctrl & 0x80) == 0; }
+
+    /// @returns the hash @p hash with all its bits mixed, so that both the group index and the
+    /// control byte derived from the hash are well distributed, even for weak hashes such as
+    /// pointer values.
+    /// @param hash the key hash
+    static uint64_t Mix(HashCode hash) {
+        uint64_t h = static_cast<uint64_t>(hash);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    /// @returns the control byte for the mixed hash @p mixed
+    /// @param mixed the hash returned by Mix()
+    static uint8_t H2(uint64_t mixed) { return static_cast<uint8_t>(mixed & 0x7f); }
+
+    /// @returns the first group to probe for the mixed hash @p mixed
+    /// @param mixed the hash returned by Mix()
+    size_t H1(uint64_t mixed) const {
+        return static_cast<size_t>(mixed >> 7) & (num_groups_ - 1);
+    }
+
+    /// Node holds an Entry.
+    struct Node {
+        /// Destructs the entry.
+        void Destroy() { Entry().~ENTRY(); }
+
+        /// @returns the storage reinterpreted as an `Entry&`
+        ENTRY& Entry() { return storage.Get(); }
+
+        /// @returns the storage reinterpreted as a `const Entry&`
+        const ENTRY& Entry() const { return storage.Get(); }
+
+        /// @returns a reference to the Entry's HashmapKey
+        const GroupedHashmapBase::Key& Key() const {
+            return GroupedHashmapBase::Entry::KeyOf(Entry());
+        }
+
+        /// @param hash the hash value to compare against the Entry's key hash value
+        /// @param value the value to compare against the Entry's key
+        /// @returns true if the Entry's hash is equal to @p hash, and the Entry's key is equal to
+        /// @p value.
+        template <typename T>
+        bool Equals(HashCode hash, T&& value) const {
+            auto& key = Key();
+            return key.hash == hash && GroupedHashmapBase::Equal{}(key.Value(), value);
+        }
+
+        /// storage is a buffer that has the same size and alignment as Entry.
+        /// The storage holds a constructed Entry when indexed by a group, and is destructed when
+        /// removed from the map.
+        AlignedStorage<ENTRY> storage;
+
+        /// next is the next Node in the free list.
+        Node* next;
+    };
+
+    /// Group is a fixed-size group of buckets, which is probed as a whole.
+    struct Group {
+        /// Constructor. Constructs a group of empty buckets.
+        Group() { ctrl.fill(kEmpty); }
+
+        /// @returns a bitmask of the buckets with the control byte @p h2.
+        /// @param h2 the control byte to match
+        uint32_t Match(uint8_t h2) const {
+#if TINT_GROUPED_HASHMAP_USE_SSE2
+            auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl.data()));
+            auto match = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(h2)));
+            return static_cast<uint32_t>(_mm_movemask_epi8(match));
+#else
+            return MatchWords([&](uint64_t word) {
+                // Zero the bytes equal to h2, then set the MSB of each byte that was zero.
+                uint64_t x = word ^ (kLSBs * h2);
+                return ~(((x & ~kMSBs) + ~kMSBs) | x) & kMSBs;
+            });
+#endif
+        }
+
+        /// @returns a bitmask of the empty buckets
+        uint32_t MatchEmpty() const {
+#if TINT_GROUPED_HASHMAP_USE_SSE2
+            return Match(kEmpty);
+#else
+            // kEmpty is the only control byte with the MSB set and bit 6 clear.
+            return MatchWords([](uint64_t word) { return word & ~(word << 1) & kMSBs; });
+#endif
+        }
+
+        /// @returns a bitmask of the empty or deleted buckets
+        uint32_t MatchEmptyOrDeleted() const {
+            // kEmpty and kDeleted are the only control bytes with the most significant bit set.
+#if TINT_GROUPED_HASHMAP_USE_SSE2
+            auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl.data()));
+            return static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+#else
+            return MatchWords([](uint64_t word) { return word & kMSBs; });
+#endif
+        }
+
+        /// @returns a bitmask of the buckets holding entries
+        uint32_t MatchFull() const { return ~MatchEmptyOrDeleted() & kAllBuckets; }
+
+#if !TINT_GROUPED_HASHMAP_USE_SSE2
+        /// A 64-bit word with the least significant bit of each byte set.
+        static constexpr uint64_t kLSBs = 0x0101010101010101ull;
+        /// A 64-bit word with the most significant bit of each byte set.
+        static constexpr uint64_t kMSBs = 0x8080808080808080ull;
+
+        /// Tests the control bytes eight at a time, using 64-bit word arithmetic.
+        /// @param f a function that takes a word of eight control bytes, and returns a word with
+        /// the MSB of each matching byte set.
+        /// @returns a bitmask of the buckets matched by @p f
+        template <typename F>
+        uint32_t MatchWords(F&& f) const {
+            uint32_t mask = 0;
+            for (size_t w = 0; w < kGroupSize / 8; w++) {
+                uint64_t word;
+                memcpy(&word, ctrl.data() + w * 8, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                word = __builtin_bswap64(word);  // Byte i must be in bits [8i, 8i+7].
+#endif
+                // Gather the MSB of each byte into the top byte, with byte i in bit 56+i.
+                uint64_t msbs = f(word) >> 7;
+                mask |= static_cast<uint32_t>((msbs * 0x0102040810204080ull) >> 56) << (w * 8);
+            }
+            return mask;
+        }
+#endif
+
+        /// The control bytes of the buckets.
+        std::array<uint8_t, kGroupSize> ctrl;
+        /// The nodes of the buckets. Only valid for buckets with a full control byte.
+        std::array<Node*, kGroupSize> nodes;
+    };
+
+    /// @returns the groups of the map
+    Slice<Group> Groups() const { return Slice<Group>(groups_, num_groups_); }
+
+    /// @returns the node held by the bucket with index @p bucket
+    /// @param bucket the bucket index
+    Node* NodeAt(size_t bucket) const {
+        return groups_[bucket / kGroupSize].nodes[bucket % kGroupSize];
+    }
+
+    /// @returns the index of the bucket holding the entry with the given hash and key, or
+    /// kNotFound if the map does not hold the key.
+    /// @param hash the key hash to search for.
+    /// @param key the key value to search for.
+    /// @param free_bucket if not null, then this is assigned the index of the first empty or
+    /// deleted bucket of the probe sequence, if the key was not found. This is the bucket that
+    /// Place() would use to index a node with the same hash.
+    template <typename K>
+    size_t Find(HashCode hash, K&& key, size_t* free_bucket = nullptr) const {
+        uint64_t mixed = Mix(hash);
+        uint8_t h2 = H2(mixed);
+        size_t mask = num_groups_ - 1;
+        // Triangular probing visits every group, as the number of groups is a power of two.
+        for (size_t group_idx = H1(mixed), stride = 1;; group_idx = (group_idx + stride++) & mask) {
+            auto& group = groups_[group_idx];
+            for (uint32_t bits = group.Match(h2); bits != 0; bits &= bits - 1) {
+                size_t i = CountTrailingZeros(bits);
+                if (group.nodes[i]->Equals(hash, key)) {
+                    return group_idx * kGroupSize + i;
+                }
+            }
+            if (free_bucket && *free_bucket == kNotFound) {
+                if (uint32_t bits = group.MatchEmptyOrDeleted(); bits != 0) {
+                    *free_bucket = group_idx * kGroupSize + CountTrailingZeros(bits);
+                }
+            }
+            if (group.MatchEmpty()) {
+                return kNotFound;
+            }
+        }
+    }
+
+    /// Indexes @p node in the first empty or deleted bucket of the probe sequence for @p hash.
+    /// @param hash the hash of the node's key
+    /// @param node the node to index
+    void Place(HashCode hash, Node* node) {
+        uint64_t mixed = Mix(hash);
+        size_t mask = num_groups_ - 1;
+        for (size_t group_idx = H1(mixed), stride = 1;; group_idx = (group_idx + stride++) & mask) {
+            if (uint32_t bits = groups_[group_idx].MatchEmptyOrDeleted(); bits != 0) {
+                PlaceAt(group_idx * kGroupSize + CountTrailingZeros(bits), H2(mixed), node);
+                return;
+            }
+        }
+    }
+
+    /// Indexes @p node in the empty or deleted bucket with index @p bucket.
+    /// @param bucket the bucket index
+    /// @param h2 the control byte for the node's key, as returned by H2()
+    /// @param node the node to index
+    void PlaceAt(size_t bucket, uint8_t h2, Node* node) {
+        auto& group = groups_[bucket / kGroupSize];
+        auto& ctrl = group.ctrl[bucket % kGroupSize];
+        if (ctrl == kDeleted) {
+            num_deleted_--;
+        }
+        ctrl = h2;
+        group.nodes[bucket % kGroupSize] = node;
+    }
+
+    /// Copies the hashmap @p other into this empty hashmap.
+    /// @note This hashmap must be empty before calling
+    /// @param other the hashmap to copy
+    void Copy(const GroupedHashmapBase& other) {
+        Reserve(other.capacity_);
+        for (auto& o : other.Groups()) {
+            for (size_t i = 0; i < kGroupSize; i++) {
+                if (IsFull(o.ctrl[i])) {
+                    auto* node = free_.Take();
+                    new (&node->Entry()) Entry{o.nodes[i]->Entry()};
+                    Place(node->Key().hash, node);
+                }
+            }
+        }
+        count_ = other.count_;
+    }
+
+    /// Moves the the hashmap @p other into this empty hashmap.
+    /// @note This hashmap must be empty before calling
+    /// @param other the hashmap to move
+    void Move(GroupedHashmapBase&& other) {
+        Reserve(other.capacity_);
+        for (auto& o : other.Groups()) {
+            for (size_t i = 0; i < kGroupSize; i++) {
+                if (IsFull(o.ctrl[i])) {
+                    auto* node = free_.Take();
+                    new (&node->Entry()) Entry{std::move(o.nodes[i]->Entry())};
+                    Place(node->Key().hash, node);
+                }
+            }
+        }
+        count_ = other.count_;
+        other.Clear();
+    }
+
+    /// EditIndex is the structure returned by EditAt(), used to simplify entry replacement and
+    /// insertion.
+    struct EditIndex {
+        /// The GroupedHashmapBase that created this EditIndex
+        GroupedHashmapBase& map;
+        /// The hash of the key, passed to EditAt().
+        HashCode hash;
+        /// The resolved node entry, or nullptr if EditAt() did not resolve to an existing entry.
+        Entry* entry = nullptr;
+        /// The bucket that Insert() will index the new entry in, if #entry is nullptr.
+        size_t free_bucket = kNotFound;
+
+        /// Replace will replace the entry with a new Entry built from @p key and @p values.
+        /// @note #entry must not be null before calling.
+        /// @note the new key must have equality to the old key.
+        /// @param key the key value (inner value of a HashmapKey).
+        /// @param values optional additional values to pass to the Entry constructor.
+        template <typename K, typename... V>
+        void Replace(K&& key, V&&... values) {
+            *entry = Entry{Key{hash, std::forward<K>(key)}, std::forward<V>(values)...};
+        }
+
+        /// Insert will create a new entry using @p key and @p values and insert it into the map.
+        /// The created entry will be assigned to #entry before returning.
+        /// @note #entry must be null before calling.
+        /// @note the key must not already exist in the map.
+        /// @param key the key value (inner value of a HashmapKey).
+        /// @param values optional additional values to pass to the Entry constructor.
+        template <typename K, typename... V>
+        void Insert(K&& key, V&&... values) {
+            auto* node = map.free_.Take();
+            map.PlaceAt(free_bucket, H2(Mix(hash)), node);
+            map.count_++;
+            entry = &node->Entry();
+            new (entry) Entry{Key{hash, std::forward<K>(key)}, std::forward<V>(values)...};
+        }
+    };
+
+    /// EditAt is a helper for map entry replacement and entry insertion.
+    /// Before indexing, EditAt will ensure there's at least one free node and one free bucket
+    /// available, potentially allocating and rehashing.
+    /// @param key the key used to compute the hash and search for the existing node.
+    /// @returns a EditIndex used to modify or insert a new entry into the map with the given key.
+    template <typename K>
+    EditIndex EditAt(K&& key) {
+        if (!free_.nodes_) {
+            free_.Allocate(capacity_);
+            capacity_ += capacity_;
+            Grow();
+        }
+        if (count_ + num_deleted_ >= MaxLoad(num_groups_)) {
+            // Too many deleted buckets. Rehash to reclaim them.
+            Rehash(num_groups_);
+        }
+        HashCode hash = Hash{}(key);
+        size_t free_bucket = kNotFound;
+        size_t bucket = Find(hash, key, &free_bucket);
+        if (bucket != kNotFound) {
+            return {*this, hash, &NodeAt(bucket)->Entry()};
+        }
+        return {*this, hash, nullptr, free_bucket};
+    }
+
+    /// Grow rehashes the map into more groups if the groups cannot index #capacity_ entries.
+    void Grow() {
+        if (size_t num_groups = NumGroups(capacity_); num_groups > num_groups_) {
+            Rehash(num_groups);
+        }
+    }
+
+    /// Rehash resizes the groups vector to @p num_groups groups, and then re-indexes the nodes of
+    /// the map, dropping all deleted buckets.
+    /// @param num_groups the new number of groups. Must be a power of two.
+    void Rehash(size_t num_groups) {
+        // Keep the old groups alive until all their nodes have been re-indexed.
+        std::unique_ptr<Group[]> old_heap_groups = std::move(heap_groups_);
+        Slice<Group> old_groups = Groups();
+        if (num_groups == fixed_groups_.size()) {
+            // Rehashing the fixed groups in place, to drop deleted buckets.
+            old_heap_groups.reset(new Group[num_groups]);
+            std::copy(fixed_groups_.begin(), fixed_groups_.end(), old_heap_groups.get());
+            old_groups = Slice<Group>(old_heap_groups.get(), num_groups);
+            fixed_groups_.fill(Group{});
+        } else {
+            heap_groups_.reset(new Group[num_groups]);
+            groups_ = heap_groups_.get();
+        }
+        num_groups_ = num_groups;
+        num_deleted_ = 0;
+        for (auto& group : old_groups) {
+            for (size_t i = 0; i < kGroupSize; i++) {
+                if (IsFull(group.ctrl[i])) {
+                    Place(group.nodes[i]->Key().hash, group.nodes[i]);
+                }
+            }
+        }
+    }
+
+    /// Free holds a linked list of nodes which are currently not used by entries in the map, and a
+    /// linked list of node allocations.
+    struct FreeNodes {
+        /// Allocation is the header of a block of memory that holds Nodes.
+        struct Allocation {
+            /// The linked list of allocations.
+            Allocation* next = nullptr;
+            // Node[] array follows this structure.
+        };
+
+        /// The linked list of free nodes.
+        Node* nodes_ = nullptr;
+
+        /// The linked list of allocations.
+        Allocation* allocations_ = nullptr;
+
+        /// Destructor.
+        /// Frees all the allocations made.
+        ~FreeNodes() {
+            auto* allocation = allocations_;
+            while (allocation) {
+                auto* next = allocation->next;
+                free(allocation);
+                allocation = next;
+            }
+        }
+
+        /// @returns the next free node in the list
+        Node* Take() {
+            auto* node = nodes_;
+            nodes_ = node->next;
+            node->next = nullptr;
+            return node;
+        }
+
+        /// Add adds the node @p node to the list of free nodes.
+        /// @note The node must be unlinked from any existing list before calling.
+        /// @param node the node to add.
+        void Add(Node* node) {
+            node->next = nodes_;
+            nodes_ = node;
+        }
+
+        /// Allocate allocates an additional @p count nodes and adds them to the free node list.
+        /// @param count the number of new nodes to allocate.
+        /// @note callers must remember to increment GroupedHashmapBase::capacity_ by the same
+        /// amount.
+        void Allocate(size_t count) {
+            static_assert(std::is_trivial_v<Node>,
+                          "Node is not trivial, and will require construction / destruction");
+            constexpr size_t kAllocationSize = RoundUp(alignof(Node), sizeof(Allocation));
+            auto* memory =
+                reinterpret_cast<std::byte*>(malloc(kAllocationSize + sizeof(Node) * count));
+            if (TINT_UNLIKELY(!memory)) {
+                TINT_ICE() << "out of memory";
+                return;
+            }
+            auto* nodes_allocation = Bitcast<Allocation*>(memory);
+            nodes_allocation->next = allocations_;
+            allocations_ = nodes_allocation;
+
+            auto* nodes = Bitcast<Node*>(memory + kAllocationSize);
+            for (size_t i = 0; i < count; i++) {
+                Add(&nodes[i]);
+            }
+        }
+    };
+
+    /// The fixed-size array of nodes, used for the first kMinCapacity entries of the map, before
+    /// allocating from the heap.
+    std::array<Node, kMinCapacity> fixed_;
+    /// The fixed-size array of groups, used to index the nodes before the map outgrows them.
+    std::array<Group, NumGroups(N)> fixed_groups_;
+    /// The heap-allocated groups, used once the map has outgrown #fixed_groups_.
+    std::unique_ptr<Group[]> heap_groups_;
+    /// The groups indexing the nodes which hold entries in the map. Points to either the
+    /// #fixed_groups_ or the #heap_groups_. Accessed through a raw pointer, as bounds checking the
+    /// accesses on the hot lookup path is measurably expensive, and the probe indices are always
+    /// masked to the number of groups.
+    Group* groups_ = fixed_groups_.data();
+    /// The number of groups pointed to by #groups_. Always a power of two.
+    size_t num_groups_ = NumGroups(N);
+    /// The linked list of free nodes, and node allocations from the heap.
+    FreeNodes free_;
+    /// The total number of nodes, including free nodes (kMinCapacity + heap-allocated)
+    size_t capacity_ = kMinCapacity;
+    /// The total number of nodes that currently hold map entries.
+    size_t count_ = 0;
+    /// The number of buckets with the kDeleted control byte.
+    size_t num_deleted_ = 0;
+};
+
+}  // namespace tint
+
+#endif  // SRC_TINT_UTILS_CONTAINERS_GROUPED_HASHMAP_BASE_H_
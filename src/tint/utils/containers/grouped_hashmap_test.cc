@@ -0,0 +1,199 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/utils/containers/grouped_hashmap.h"
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include "gmock/gmock.h"
+
+namespace tint {
+namespace {
+
+TEST(GroupedHashmap, Empty) {
+    GroupedHashmap<std::string, int, 8> map;
+    EXPECT_EQ(map.Count(), 0u);
+    EXPECT_TRUE(map.begin() == map.end());
+}
+
+TEST(GroupedHashmap, AddRemove) {
+    GroupedHashmap<std::string, std::string, 8> map;
+    EXPECT_TRUE(map.Add("hello", "world"));
+    EXPECT_EQ(map.Get("hello"), "world");
+    EXPECT_EQ(map.Count(), 1u);
+    EXPECT_TRUE(map.Contains("hello"));
+    EXPECT_FALSE(map.Contains("world"));
+    EXPECT_FALSE(map.Add("hello", "cat"));
+    EXPECT_EQ(map.Count(), 1u);
+    EXPECT_TRUE(map.Remove("hello"));
+    EXPECT_EQ(map.Count(), 0u);
+    EXPECT_FALSE(map.Contains("hello"));
+    EXPECT_FALSE(map.Contains("world"));
+}
+
+TEST(GroupedHashmap, Soak) {
+    std::mt19937 rnd;
+    std::unordered_map<int, int> reference;
+    GroupedHashmap<int, int, 8> map;
+    for (size_t i = 0; i < 200000; i++) {
+        int key = static_cast<int>(rnd() % 4096);
+        int value = static_cast<int>(rnd());
+        switch (rnd() % 6) {
+            case 0:
+            case 1: {  // Add
+                auto expected = reference.emplace(key, value).second;
+                ASSERT_EQ(map.Add(key, value), expected) << "i:" << i;
+                break;
+            }
+            case 2: {  // Remove
+                auto expected = reference.erase(key) != 0;
+                ASSERT_EQ(map.Remove(key), expected) << "i:" << i;
+                break;
+            }
+            case 3: {  // Get
+                auto it = reference.find(key);
+                if (it != reference.end()) {
+                    ASSERT_EQ(map.Get(key), it->second) << "i:" << i;
+                } else {
+                    ASSERT_FALSE(map.Get(key)) << "i:" << i;
+                }
+                break;
+            }
+            case 4: {  // Copy / Move
+                if (rnd() % 64 == 0) {
+                    GroupedHashmap<int, int, 8> tmp(map);
+                    map = std::move(tmp);
+                }
+                break;
+            }
+            case 5: {  // Clear
+                if (rnd() % 4096 == 0) {
+                    reference.clear();
+                    map.Clear();
+                }
+                break;
+            }
+        }
+        ASSERT_EQ(map.Count(), reference.size()) << "i:" << i;
+    }
+    size_t count = 0;
+    for (auto& it : map) {
+        ASSERT_EQ(reference[it.key.Value()], it.value);
+        count++;
+    }
+    EXPECT_EQ(count, reference.size());
+}
+
+TEST(GroupedHashmap, RemoveAndReAddMany) {
+    GroupedHashmap<int, int, 8> map;
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < 100; i++) {
+            ASSERT_TRUE(map.Add(round * 100 + i, i)) << "round: " << round << " i: " << i;
+        }
+        ASSERT_EQ(map.Count(), 100u);
+        for (int i = 0; i < 100; i++) {
+            ASSERT_TRUE(map.Remove(round * 100 + i)) << "round: " << round << " i: " << i;
+        }
+        ASSERT_EQ(map.Count(), 0u);
+        ASSERT_TRUE(map.begin() == map.end());
+    }
+}
+
+TEST(GroupedHashmap, Clear) {
+    GroupedHashmap<int, int, 8> map;
+    for (int i = 0; i < 100; i++) {
+        map.Add(i, i);
+    }
+    map.Clear();
+    EXPECT_EQ(map.Count(), 0u);
+    EXPECT_TRUE(map.IsEmpty());
+    EXPECT_TRUE(map.begin() == map.end());
+    for (int i = 0; i < 100; i++) {
+        EXPECT_FALSE(map.Contains(i));
+    }
+    EXPECT_TRUE(map.Add(42, 1));
+    EXPECT_EQ(map.Count(), 1u);
+}
+
+TEST(GroupedHashmap, EntriesDoNotMoveOnGrowth) {
+    GroupedHashmap<int, std::string, 4> map;
+    map.Add(0, "zero");
+    auto* zero = &map.GetOrAddZero(0);
+    for (int i = 1; i < 1000; i++) {
+        map.Add(i, std::to_string(i));
+    }
+    EXPECT_EQ(zero, &map.GetOrAddZero(0));
+    EXPECT_EQ(*zero, "zero");
+}
+
+/// A hasher that returns the same hash for every key
+struct CollidingHasher {
+    HashCode operator()(int) const { return 42; }
+};
+
+TEST(GroupedHashmap, CollidingHashes) {
+    GroupedHashmap<int, int, 8, CollidingHasher> map;
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(map.Add(i, i * 10)) << i;
+    }
+    for (int i = 0; i < 100; i += 2) {
+        ASSERT_TRUE(map.Remove(i)) << i;
+    }
+    ASSERT_EQ(map.Count(), 50u);
+    for (int i = 0; i < 100; i++) {
+        if (i & 1) {
+            EXPECT_EQ(map.Get(i), i * 10) << i;
+        } else {
+            EXPECT_FALSE(map.Contains(i)) << i;
+        }
+    }
+    for (int i = 100; i < 200; i++) {
+        ASSERT_TRUE(map.Add(i, i * 10)) << i;
+    }
+    EXPECT_EQ(map.Count(), 150u);
+    EXPECT_EQ(map.Get(150), 1500);
+}
+
+TEST(GroupedHashmap, EqualityWithHashmap) {
+    GroupedHashmap<int, std::string, 8> a;
+    Hashmap<int, std::string, 4> b;
+    EXPECT_EQ(a, b);
+    a.Add(1, "one");
+    EXPECT_NE(a, b);
+    b.Add(2, "two");
+    EXPECT_NE(a, b);
+    a.Add(2, "two");
+    EXPECT_NE(a, b);
+    b.Add(1, "one");
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(Hash(a), Hash(b));
+}
+
+}  // namespace
+}  // namespace tint
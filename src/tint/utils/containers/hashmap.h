@@ -133,13 +133,16 @@ struct AddResult {
 };
 
 /// An unordered hashmap, with a fixed-size capacity that avoids heap allocations.
+/// @tparam BASE the hash table implementation. Defaults to HashmapBase. See GroupedHashmap for an
+/// alternative that favours lookups in large maps.
 template <typename KEY,
           typename VALUE,
           size_t N,
           typename HASH = Hasher<KEY>,
-          typename EQUAL = EqualTo<KEY>>
-class Hashmap : public HashmapBase<HashmapEntry<HashmapKey<KEY, HASH, EQUAL>, VALUE>, N> {
-    using Base = HashmapBase<HashmapEntry<HashmapKey<KEY, HASH, EQUAL>, VALUE>, N>;
+          typename EQUAL = EqualTo<KEY>,
+          template <typename, size_t> class BASE = HashmapBase>
+class Hashmap : public BASE<HashmapEntry<HashmapKey<KEY, HASH, EQUAL>, VALUE>, N> {
+    using Base = BASE<HashmapEntry<HashmapKey<KEY, HASH, EQUAL>, VALUE>, N>;
 
   public:
     /// The key type
@@ -303,8 +306,14 @@ class Hashmap : public HashmapBase<HashmapEntry<HashmapKey<KEY, HASH, EQUAL>, VA
     /// Equality operator
     /// @param other the other Hashmap to compare this Hashmap to
     /// @returns true if this Hashmap has the same key and value pairs as @p other
-    template <typename K, typename V, size_t N2>
-    bool operator==(const Hashmap<K, V, N2>& other) const {
+    template <typename K,
+              typename V,
+              size_t N2,
+              typename HASH2,
+              typename EQUAL2,
+              template <typename, size_t>
+              class BASE2>
+    bool operator==(const Hashmap<K, V, N2, HASH2, EQUAL2, BASE2>& other) const {
         if (this->Count() != other.Count()) {
             return false;
         }
@@ -320,18 +329,30 @@ class Hashmap : public HashmapBase<HashmapEntry<HashmapKey<KEY, HASH, EQUAL>, VA
     /// Inequality operator
     /// @param other the other Hashmap to compare this Hashmap to
     /// @returns false if this Hashmap has the same key and value pairs as @p other
-    template <typename K, typename V, size_t N2>
-    bool operator!=(const Hashmap<K, V, N2>& other) const {
+    template <typename K,
+              typename V,
+              size_t N2,
+              typename HASH2,
+              typename EQUAL2,
+              template <typename, size_t>
+              class BASE2>
+    bool operator!=(const Hashmap<K, V, N2, HASH2, EQUAL2, BASE2>& other) const {
         return !(*this == other);
     }
 };
 
 /// Hasher specialization for Hashmap
-template <typename K, typename V, size_t N, typename HASH, typename EQUAL>
-struct Hasher<Hashmap<K, V, N, HASH, EQUAL>> {
+template <typename K,
+          typename V,
+          size_t N,
+          typename HASH,
+          typename EQUAL,
+          template <typename, size_t>
+          class BASE>
+struct Hasher<Hashmap<K, V, N, HASH, EQUAL, BASE>> {
     /// @param map the Hashmap to hash
     /// @returns a hash of the map
-    HashCode operator()(const Hashmap<K, V, N, HASH, EQUAL>& map) const {
+    HashCode operator()(const Hashmap<K, V, N, HASH, EQUAL, BASE>& map) const {
         auto hash = Hash(map.Count());
         for (auto it : map) {
             // Use an XOR to ensure that the non-deterministic ordering of the map still produces
@@ -352,8 +373,10 @@ template <typename STREAM,
           size_t N,
           typename HASH,
           typename EQUAL,
+          template <typename, size_t>
+          class BASE,
           typename = traits::EnableIfIsOStream<STREAM>>
-auto& operator<<(STREAM& out, const Hashmap<KEY, VALUE, N, HASH, EQUAL>& map) {
+auto& operator<<(STREAM& out, const Hashmap<KEY, VALUE, N, HASH, EQUAL, BASE>& map) {
     out << "Hashmap{";
     bool first = true;
     for (auto it : map) {
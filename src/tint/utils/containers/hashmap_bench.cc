@@ -0,0 +1,152 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "src/tint/utils/containers/grouped_hashmap.h"
+#include "src/tint/utils/containers/hashmap.h"
+
+namespace tint {
+namespace {
+
+/// Most of Tint's hot maps are keyed on pointers to AST, semantic or type nodes.
+struct Object {
+    uint64_t a, b;
+};
+using Key = const Object*;
+
+/// @returns a shuffled list of @p n unique pointer keys
+std::vector<Key> MakeKeys(const std::vector<Object>& storage, size_t n) {
+    std::vector<Key> keys;
+    keys.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        keys.push_back(&storage[i]);
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937{});
+    return keys;
+}
+
+/// Adapter for tint::Hashmap and tint::GroupedHashmap
+template <typename HASHMAP>
+struct TintHashmapT {
+    HASHMAP map;
+    void Add(Key key, int value) { map.Add(key, value); }
+    bool Contains(Key key) const { return map.Contains(key); }
+    template <typename F>
+    void Foreach(F&& f) const {
+        for (auto& it : map) {
+            f(it.value);
+        }
+    }
+};
+
+using TintHashmap = TintHashmapT<Hashmap<Key, int, 8>>;
+using TintGroupedHashmap = TintHashmapT<GroupedHashmap<Key, int, 8>>;
+
+/// Adapter for std::unordered_map
+struct StdUnorderedMap {
+    std::unordered_map<Key, int> map;
+    void Add(Key key, int value) { map.emplace(key, value); }
+    bool Contains(Key key) const { return map.count(key) != 0; }
+    template <typename F>
+    void Foreach(F&& f) const {
+        for (auto& it : map) {
+            f(it.second);
+        }
+    }
+};
+
+template <typename MAP>
+void Insert(::benchmark::State& state) {
+    size_t n = static_cast<size_t>(state.range(0));
+    std::vector<Object> storage(n);
+    auto keys = MakeKeys(storage, n);
+    for (auto _ : state) {
+        MAP map;
+        for (size_t i = 0; i < n; i++) {
+            map.Add(keys[i], static_cast<int>(i));
+        }
+        ::benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+
+template <typename MAP>
+void Lookup(::benchmark::State& state) {
+    size_t n = static_cast<size_t>(state.range(0));
+    // Half of the lookups are for keys that are not in the map.
+    std::vector<Object> storage(n * 2);
+    auto keys = MakeKeys(storage, n * 2);
+    MAP map;
+    for (size_t i = 0; i < n; i++) {
+        map.Add(keys[i * 2], static_cast<int>(i));
+    }
+    for (auto _ : state) {
+        size_t found = 0;
+        for (auto key : keys) {
+            found += map.Contains(key) ? 1 : 0;
+        }
+        ::benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+
+template <typename MAP>
+void Iterate(::benchmark::State& state) {
+    size_t n = static_cast<size_t>(state.range(0));
+    std::vector<Object> storage(n);
+    auto keys = MakeKeys(storage, n);
+    MAP map;
+    for (size_t i = 0; i < n; i++) {
+        map.Add(keys[i], static_cast<int>(i));
+    }
+    for (auto _ : state) {
+        int sum = 0;
+        map.Foreach([&](int value) { sum += value; });
+        ::benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+
+BENCHMARK(Insert<TintHashmap>)->Range(8, 1 << 14);
+BENCHMARK(Insert<TintGroupedHashmap>)->Range(8, 1 << 14);
+BENCHMARK(Insert<StdUnorderedMap>)->Range(8, 1 << 14);
+BENCHMARK(Lookup<TintHashmap>)->Range(8, 1 << 14);
+BENCHMARK(Lookup<TintGroupedHashmap>)->Range(8, 1 << 14);
+BENCHMARK(Lookup<StdUnorderedMap>)->Range(8, 1 << 14);
+BENCHMARK(Iterate<TintHashmap>)->Range(8, 1 << 14);
+BENCHMARK(Iterate<TintGroupedHashmap>)->Range(8, 1 << 14);
+BENCHMARK(Iterate<StdUnorderedMap>)->Range(8, 1 << 14);
+
+}  // namespace
+}  // namespace tint
@@ -468,6 +468,115 @@ TEST(Hashmap, Soak) {
     }
 }
 
+TEST(Hashmap, SoakManyKeys) {
+    std::mt19937 rnd;
+    std::unordered_map<int, int> reference;
+    Hashmap<int, int, 8> map;
+    for (size_t i = 0; i < 200000; i++) {
+        int key = static_cast<int>(rnd() % 4096);
+        int value = static_cast<int>(rnd());
+        switch (rnd() % 4) {
+            case 0:
+            case 1: {  // Add
+                auto expected = reference.emplace(key, value).second;
+                ASSERT_EQ(map.Add(key, value), expected) << "i:" << i;
+                break;
+            }
+            case 2: {  // Remove
+                auto expected = reference.erase(key) != 0;
+                ASSERT_EQ(map.Remove(key), expected) << "i:" << i;
+                break;
+            }
+            case 3: {  // Get
+                auto it = reference.find(key);
+                if (it != reference.end()) {
+                    ASSERT_EQ(map.Get(key), it->second) << "i:" << i;
+                } else {
+                    ASSERT_FALSE(map.Get(key)) << "i:" << i;
+                }
+                break;
+            }
+        }
+        ASSERT_EQ(map.Count(), reference.size()) << "i:" << i;
+    }
+    size_t count = 0;
+    for (auto& it : map) {
+        ASSERT_EQ(reference[it.key.Value()], it.value);
+        count++;
+    }
+    EXPECT_EQ(count, reference.size());
+}
+
+TEST(Hashmap, RemoveAndReAddMany) {
+    Hashmap<int, int, 8> map;
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < 100; i++) {
+            ASSERT_TRUE(map.Add(round * 100 + i, i)) << "round: " << round << " i: " << i;
+        }
+        ASSERT_EQ(map.Count(), 100u);
+        for (int i = 0; i < 100; i++) {
+            ASSERT_TRUE(map.Remove(round * 100 + i)) << "round: " << round << " i: " << i;
+        }
+        ASSERT_EQ(map.Count(), 0u);
+        ASSERT_TRUE(map.begin() == map.end());
+    }
+}
+
+TEST(Hashmap, Clear) {
+    Hashmap<int, int, 8> map;
+    for (int i = 0; i < 100; i++) {
+        map.Add(i, i);
+    }
+    map.Clear();
+    EXPECT_EQ(map.Count(), 0u);
+    EXPECT_TRUE(map.IsEmpty());
+    EXPECT_TRUE(map.begin() == map.end());
+    for (int i = 0; i < 100; i++) {
+        EXPECT_FALSE(map.Contains(i));
+    }
+    EXPECT_TRUE(map.Add(42, 1));
+    EXPECT_EQ(map.Count(), 1u);
+}
+
+TEST(Hashmap, EntriesDoNotMoveOnGrowth) {
+    Hashmap<int, std::string, 4> map;
+    map.Add(0, "zero");
+    auto* zero = &map.GetOrAddZero(0);
+    for (int i = 1; i < 1000; i++) {
+        map.Add(i, std::to_string(i));
+    }
+    EXPECT_EQ(zero, &map.GetOrAddZero(0));
+    EXPECT_EQ(*zero, "zero");
+}
+
+/// A hasher that returns the same hash for every key
+struct CollidingHasher {
+    HashCode operator()(int) const { return 42; }
+};
+
+TEST(Hashmap, CollidingHashes) {
+    Hashmap<int, int, 8, CollidingHasher> map;
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(map.Add(i, i * 10)) << i;
+    }
+    for (int i = 0; i < 100; i += 2) {
+        ASSERT_TRUE(map.Remove(i)) << i;
+    }
+    ASSERT_EQ(map.Count(), 50u);
+    for (int i = 0; i < 100; i++) {
+        if (i & 1) {
+            EXPECT_EQ(map.Get(i), i * 10) << i;
+        } else {
+            EXPECT_FALSE(map.Contains(i)) << i;
+        }
+    }
+    for (int i = 100; i < 200; i++) {
+        ASSERT_TRUE(map.Add(i, i * 10)) << i;
+    }
+    EXPECT_EQ(map.Count(), 150u);
+    EXPECT_EQ(map.Get(150), 1500);
+}
+
 TEST(Hashmap, EqualitySameSize) {
     Hashmap<int, std::string, 8> a;
     Hashmap<int, std::string, 8> b;
@@ -97,7 +97,9 @@ struct Hasher<T*> {
         hash ^= static_cast<uint32_t>(TINT_HASH_SEED);
 #endif
         if constexpr (sizeof(hash) > 4) {
-            return static_cast<HashCode>(hash >> 4 | hash >> 32);
+            // Fold the upper bits in with an XOR. An OR would force the low bits of the hash to
+            // the bits that are common to all heap addresses, causing heavy collisions.
+            return static_cast<HashCode>((hash >> 4) ^ (hash >> 32));
         } else {
             return static_cast<HashCode>(hash >> 4);
         }
@@ -33,6 +33,10 @@
 #include <string>
 #include <type_traits>
 
+#if defined(_MSC_VER)
+#include <intrin.h>  // _BitScanForward
+#endif
+
 namespace tint {
 
 /// @param alignment the next multiple to round `value` to
@@ -89,6 +93,26 @@ inline constexpr uint32_t Log2(uint64_t value) {
     return 64;
 }
 
+/// @param value the input value. Must not be zero.
+/// @returns the number of trailing zero bits of @p value
+inline uint32_t CountTrailingZeros(uint32_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+    return static_cast<uint32_t>(__builtin_ctz(value));
+#elif defined(_MSC_VER)
+    // NOLINTNEXTLINE(runtime/int)
+    unsigned long first_bit_index = 0;
+    _BitScanForward(&first_bit_index, value);
+    return first_bit_index;
+#else
+    uint32_t count = 0;
+    while ((value & 1u) == 0) {
+        value >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
 /// @param value the input value
 /// @returns the next power of two number greater or equal to @p value
 inline constexpr uint64_t NextPowerOfTwo(uint64_t value) {
@@ -70,6 +70,18 @@ TEST(MathTests, IsPowerOfTwo) {
     EXPECT_EQ(IsPowerOfTwo(9), false);
 }
 
+TEST(MathTests, CountTrailingZeros) {
+    EXPECT_EQ(CountTrailingZeros(1u), 0u);
+    EXPECT_EQ(CountTrailingZeros(2u), 1u);
+    EXPECT_EQ(CountTrailingZeros(3u), 0u);
+    EXPECT_EQ(CountTrailingZeros(4u), 2u);
+    EXPECT_EQ(CountTrailingZeros(12u), 2u);
+    EXPECT_EQ(CountTrailingZeros(0x8000u), 15u);
+    EXPECT_EQ(CountTrailingZeros(0x18000u), 15u);
+    EXPECT_EQ(CountTrailingZeros(0x80000000u), 31u);
+    EXPECT_EQ(CountTrailingZeros(0xffffffffu), 0u);
+}
+
 TEST(MathTests, Log2) {
     EXPECT_EQ(Log2(1), 0u);
     EXPECT_EQ(Log2(2), 1u);
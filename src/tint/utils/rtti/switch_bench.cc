@@ -26,6 +26,8 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 
@@ -242,9 +244,73 @@ void CastableSmallSwitch(::benchmark::State& state) {
 
 BENCHMARK(CastableSmallSwitch);
 
+/// A leaf of the Base hierarchy that is final.
+template <size_t N>
+struct FinalLeaf final : public Castable<FinalLeaf<N>, Base> {};
+
+/// A leaf of the Base hierarchy that is not final.
+template <size_t N>
+struct NonFinalLeaf : public Castable<NonFinalLeaf<N>, Base> {};
+
+/// @returns an object of each of the types `LEAF<I>`, followed by a Base object that is not matched
+/// by any case.
+template <template <size_t> class LEAF, size_t... I>
+std::vector<std::unique_ptr<Base>> MakeLeaves(std::index_sequence<I...>) {
+    std::vector<std::unique_ptr<Base>> out;
+    (out.emplace_back(std::make_unique<LEAF<I>>()), ...);
+    out.emplace_back(std::make_unique<Base>());
+    return out;
+}
+
+/// Benchmarks a Switch() with a case for each of the types `LEAF<I>`, and a Default case.
+template <template <size_t> class LEAF, size_t... I>
+void LeafSwitch(::benchmark::State& state, std::index_sequence<I...> seq) {
+    auto objects = MakeLeaves<LEAF>(seq);
+    size_t i = 0;
+    for (auto _ : state) {
+        auto* object = objects[i % objects.size()].get();
+        Switch(
+            object,  //
+            [&](const LEAF<I>*) { ::benchmark::DoNotOptimize(i += I * 10 + 1); }...,
+            [&](Default) { ::benchmark::DoNotOptimize(i += 123); });
+        i = (i * 31) ^ (i << 5);
+    }
+}
+
+template <size_t N>
+void FinalLeafSwitch(::benchmark::State& state) {
+    LeafSwitch<FinalLeaf>(state, std::make_index_sequence<N>{});
+}
+
+template <size_t N>
+void NonFinalLeafSwitch(::benchmark::State& state) {
+    LeafSwitch<NonFinalLeaf>(state, std::make_index_sequence<N>{});
+}
+
+BENCHMARK(FinalLeafSwitch<4>);
+BENCHMARK(FinalLeafSwitch<16>);
+BENCHMARK(FinalLeafSwitch<64>);
+BENCHMARK(NonFinalLeafSwitch<4>);
+BENCHMARK(NonFinalLeafSwitch<16>);
+BENCHMARK(NonFinalLeafSwitch<64>);
+
 }  // namespace
 }  // namespace tint
 
+#define TINT_INSTANTIATE_LEAF(N)                   \
+    TINT_INSTANTIATE_TYPEINFO(tint::FinalLeaf<N>); \
+    TINT_INSTANTIATE_TYPEINFO(tint::NonFinalLeaf<N>)
+
+#define TINT_INSTANTIATE_8_LEAVES(N) \
+    TINT_INSTANTIATE_LEAF(N + 0);    \
+    TINT_INSTANTIATE_LEAF(N + 1);    \
+    TINT_INSTANTIATE_LEAF(N + 2);    \
+    TINT_INSTANTIATE_LEAF(N + 3);    \
+    TINT_INSTANTIATE_LEAF(N + 4);    \
+    TINT_INSTANTIATE_LEAF(N + 5);    \
+    TINT_INSTANTIATE_LEAF(N + 6);    \
+    TINT_INSTANTIATE_LEAF(N + 7)
+
 TINT_INSTANTIATE_TYPEINFO(tint::Base);
 TINT_INSTANTIATE_TYPEINFO(tint::A);
 TINT_INSTANTIATE_TYPEINFO(tint::AA);
@@ -285,3 +351,14 @@ TINT_INSTANTIATE_TYPEINFO(tint::CC);
 TINT_INSTANTIATE_TYPEINFO(tint::CCA);
 TINT_INSTANTIATE_TYPEINFO(tint::CCB);
 TINT_INSTANTIATE_TYPEINFO(tint::CCC);
+TINT_INSTANTIATE_8_LEAVES(0);
+TINT_INSTANTIATE_8_LEAVES(8);
+TINT_INSTANTIATE_8_LEAVES(16);
+TINT_INSTANTIATE_8_LEAVES(24);
+TINT_INSTANTIATE_8_LEAVES(32);
+TINT_INSTANTIATE_8_LEAVES(40);
+TINT_INSTANTIATE_8_LEAVES(48);
+TINT_INSTANTIATE_8_LEAVES(56);
+
+#undef TINT_INSTANTIATE_LEAF
+#undef TINT_INSTANTIATE_8_LEAVES
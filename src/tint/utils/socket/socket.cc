@@ -240,7 +240,7 @@ class Impl : public Socket {
         Lock([&](SOCKET socket, const addrinfo*) {
             if (socket != InvalidSocket) {
                 Init();
-                if (auto sock = ::accept(socket, nullptr, nullptr); s >= 0) {
+                if (auto sock = ::accept(socket, nullptr, nullptr); sock != InvalidSocket) {
                     out = std::make_shared<Impl>(sock);
                     out->SetOptions();
                 }
@@ -264,17 +264,14 @@ std::shared_ptr<Socket> Socket::Listen(const char* address, const char* port) {
     if (!impl) {
         return nullptr;
     }
+    bool ok = false;
     impl->Lock([&](SOCKET socket, const addrinfo* info) {
-        if (bind(socket, info->ai_addr, info->ai_addrlen) != 0) {
-            impl.reset();
-            return;
-        }
-
-        if (listen(socket, 0) != 0) {
-            impl.reset();
-            return;
-        }
+        ok = bind(socket, info->ai_addr, info->ai_addrlen) == 0 && listen(socket, 0) == 0;
     });
+    // The socket is released outside of Lock(), as its destructor takes the write lock.
+    if (!ok) {
+        impl.reset();
+    }
     return impl;
 }
 